@@ -0,0 +1,123 @@
+#ifndef __ANIMATIONCLOCK_H
+#define __ANIMATIONCLOCK_H
+
+#include <Arduino.h>
+
+// Time base of an animation. Effects derive their state from the time since start() instead of counting their
+// calls, so a late or dropped frame does not slow them down: the next frame simply shows a later state.
+// Progress values are fixed point numbers (Q15), ONE = 1.0.
+
+class AnimationClock
+{
+
+public:
+
+    static const uint16_t ONE = 0x8000;
+
+    AnimationClock()
+    {
+        this->start_ms_    = 0;
+        this->duration_ms_ = 0;
+        this->steps_       = 0;
+    }
+
+    void start(uint32_t duration_ms = 0)
+    {
+        this->start_ms_    = millis();
+        this->duration_ms_ = duration_ms;
+        this->steps_       = 0;
+    }
+
+    uint32_t elapsed() const
+    {
+        return millis() - this->start_ms_;
+    }
+
+    // 0..ONE over the duration given to start()
+    uint16_t progress() const
+    {
+        return progress(elapsed(), this->duration_ms_);
+    }
+
+    bool isFinished() const
+    {
+        return elapsed() >= this->duration_ms_;
+    }
+
+    // For effects that advance in discrete steps: the number of steps of 'interval_ms' that became due since the
+    // last call, the first one is due right at start(). After a late frame this catches up on all missed steps.
+    uint32_t takeSteps(uint32_t interval_ms)
+    {
+        uint32_t due = elapsed() / interval_ms + 1;
+        uint32_t n   = due - this->steps_;
+        this->steps_ = due;
+        return n;
+    }
+
+    // time [ms] until takeSteps() has the next step
+    uint32_t untilNextStep(uint32_t interval_ms) const
+    {
+        return interval_ms - elapsed() % interval_ms;
+    }
+
+    static uint16_t progress(uint32_t elapsed_ms, uint32_t duration_ms)
+    {
+        if (elapsed_ms >= duration_ms)
+            return ONE;
+        return ((uint64_t) elapsed_ms * ONE) / duration_ms;
+    }
+
+private:
+
+    uint32_t start_ms_;
+    uint32_t duration_ms_;
+    uint32_t steps_;
+
+};
+
+// Easing curves, mapping a progress 0..ONE to 0..ONE in fixed point (no float on the render path).
+
+class Easing
+{
+
+public:
+
+    typedef uint16_t (*Func)(uint16_t t);
+
+    static uint16_t linear(uint16_t t)
+    {
+        return t;
+    }
+
+    static uint16_t inQuad(uint16_t t)
+    {
+        return ((uint32_t) t * t) >> 15;
+    }
+
+    static uint16_t outQuad(uint16_t t)
+    {
+        return AnimationClock::ONE - inQuad(AnimationClock::ONE - t);
+    }
+
+    // smoothstep, 3t^2 - 2t^3
+    static uint16_t inOutCubic(uint16_t t)
+    {
+        uint32_t t2 = ((uint32_t) t * t) >> 15;
+        return (t2 * (3 * AnimationClock::ONE - 2 * (uint32_t) t)) >> 15;
+    }
+
+    // 'from' for t = 0, 'to' for t = ONE
+    static uint8_t lerp(uint8_t from, uint8_t to, uint16_t t)
+    {
+        return from + (((int32_t) to - from) * t) / (int32_t) AnimationClock::ONE;
+    }
+
+    // the same for a channel of 16 bits (see FrameBuffer.h)
+    static uint16_t lerp16(uint16_t from, uint16_t to, uint16_t t)
+    {
+        return from + (((int32_t) to - from) * t) / (int32_t) AnimationClock::ONE;
+    }
+
+};
+
+#endif  // __ANIMATIONCLOCK_H
@@ -0,0 +1,175 @@
+#ifndef __BITFRAME_H
+#define __BITFRAME_H
+
+#include <Arduino.h>
+
+#include "assertions.h"
+
+// One bit per pixel of a W x H matrix. Each row starts at a new machine word (bit i of the row's first word =
+// column i), so rows of any width work, and whole frames combine with a handful of word operations: the 13 x 11
+// matrix fits into 11 words of 32 bits. Bits beyond the width of a row are always zero.
+
+template<uint8_t W, uint8_t H, typename Word = uint32_t> class BitFrame
+{
+
+public:
+
+    static const uint8_t  WIDTH         = W;
+    static const uint8_t  HEIGHT        = H;
+    static const uint8_t  WORD_BITS     = sizeof(Word) * 8;
+    static const uint8_t  WORDS_PER_ROW = (W + WORD_BITS - 1) / WORD_BITS;
+    static const uint16_t WORD_COUNT    = WORDS_PER_ROW * H;
+
+    BitFrame()
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        for (uint16_t i = 0; i < WORD_COUNT; i++)
+            this->words_[i] = 0;
+    }
+
+    void fill()
+    {
+        for (uint16_t i = 0; i < WORD_COUNT; i++)
+            this->words_[i] = ((i + 1) % WORDS_PER_ROW == 0) ? LAST_WORD_MASK : (Word) ~(Word) 0;
+    }
+
+    bool isSet(uint8_t x, uint8_t y) const
+    {
+        ASSERT(x < W);
+        ASSERT(y < H);
+        return (this->words_[index(x, y)] >> (x % WORD_BITS)) & 0x01;
+    }
+
+    BitFrame& set(uint8_t x, uint8_t y)
+    {
+        ASSERT(x < W);
+        ASSERT(y < H);
+        this->words_[index(x, y)] |= (Word) 1 << (x % WORD_BITS);
+        return *this;
+    }
+
+    BitFrame& reset(uint8_t x, uint8_t y)
+    {
+        ASSERT(x < W);
+        ASSERT(y < H);
+        this->words_[index(x, y)] &= ~((Word) 1 << (x % WORD_BITS));
+        return *this;
+    }
+
+    // ORs 'bits' (bit i = column x + i) into row y; whatever lies outside of the frame is clipped
+    BitFrame& orBits(int16_t x, uint8_t y, Word bits)
+    {
+        ASSERT(y < H);
+        if (x <= -WORD_BITS || x >= W)
+            return *this;
+        if (x < 0)
+        {
+            bits >>= -x;
+            x = 0;
+        }
+        uint16_t i     = index(x, y);
+        uint8_t  shift = x % WORD_BITS;
+        this->words_[i] |= bits << shift;
+        if (shift > 0 && (x / WORD_BITS) + 1 < WORDS_PER_ROW)
+            this->words_[i + 1] |= bits >> (WORD_BITS - shift);
+        this->words_[(y + 1) * WORDS_PER_ROW - 1] &= LAST_WORD_MASK;
+        return *this;
+    }
+
+    // ----- whole frame operations -----
+
+    BitFrame& operator|=(const BitFrame& other)
+    {
+        for (uint16_t i = 0; i < WORD_COUNT; i++)
+            this->words_[i] |= other.words_[i];
+        return *this;
+    }
+
+    BitFrame& operator&=(const BitFrame& other)
+    {
+        for (uint16_t i = 0; i < WORD_COUNT; i++)
+            this->words_[i] &= other.words_[i];
+        return *this;
+    }
+
+    BitFrame& operator^=(const BitFrame& other)
+    {
+        for (uint16_t i = 0; i < WORD_COUNT; i++)
+            this->words_[i] ^= other.words_[i];
+        return *this;
+    }
+
+    // removes the pixels set in 'other'
+    BitFrame& andNot(const BitFrame& other)
+    {
+        for (uint16_t i = 0; i < WORD_COUNT; i++)
+            this->words_[i] &= ~other.words_[i];
+        return *this;
+    }
+
+    BitFrame operator|(const BitFrame& other) const { return BitFrame(*this) |= other; }
+    BitFrame operator&(const BitFrame& other) const { return BitFrame(*this) &= other; }
+    BitFrame operator^(const BitFrame& other) const { return BitFrame(*this) ^= other; }
+
+    // number of pixels set
+    uint16_t count() const
+    {
+        uint16_t n = 0;
+        for (uint16_t i = 0; i < WORD_COUNT; i++)
+            n += __builtin_popcountll(this->words_[i]);
+        return n;
+    }
+
+    bool any() const
+    {
+        for (uint16_t i = 0; i < WORD_COUNT; i++)
+            if (this->words_[i] != 0)
+                return true;
+        return false;
+    }
+
+    bool operator==(const BitFrame& other) const
+    {
+        for (uint16_t i = 0; i < WORD_COUNT; i++)
+            if (this->words_[i] != other.words_[i])
+                return false;
+        return true;
+    }
+
+    bool operator!=(const BitFrame& other) const
+    {
+        return !(*this == other);
+    }
+
+    // calls func(x, y) for every pixel set, row by row; empty words cost a single test
+    template<typename Func> void forEachSet(Func func) const
+    {
+        for (uint16_t i = 0; i < WORD_COUNT; i++)
+        {
+            uint8_t y  = i / WORDS_PER_ROW;
+            uint8_t x0 = (i % WORDS_PER_ROW) * WORD_BITS;
+            for (Word bits = this->words_[i]; bits != 0; bits &= bits - 1)
+                func((uint8_t) (x0 + __builtin_ctzll(bits)), y);
+        }
+    }
+
+private:
+
+    static const uint8_t LAST_WORD_BITS = W - (WORDS_PER_ROW - 1) * WORD_BITS;  // columns in a row's last word
+    static const Word    LAST_WORD_MASK = (LAST_WORD_BITS == WORD_BITS) ? (Word) ~(Word) 0
+                                                                       : (((Word) 1 << (LAST_WORD_BITS % WORD_BITS)) - 1);
+
+    static uint16_t index(uint8_t x, uint8_t y)
+    {
+        return y * WORDS_PER_ROW + x / WORD_BITS;
+    }
+
+    Word words_[WORD_COUNT];
+
+};
+
+#endif  // __BITFRAME_H
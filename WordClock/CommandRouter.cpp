@@ -0,0 +1,86 @@
+#include "CommandRouter.h"
+
+#include <limits.h>
+
+#include "assertions.h"
+
+
+CommandRouter::CommandRouter(const char* prefix, const Command* commands, uint8_t count, uint32_t seed) :
+  prefix_(prefix),
+  prefix_length_(strlen(prefix)),
+  commands_(commands),
+  count_(count),
+  seed_(seed)
+{
+    ASSERT(count <= MAX_COMMANDS);
+
+    memset(this->slots_, EMPTY, sizeof(this->slots_));
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t idx = slot(commands[i].name, seed);
+        ASSERT(this->slots_[idx] == EMPTY);  // not a perfect seed
+        this->slots_[idx] = i;
+    }
+}
+
+CommandRouter::Result CommandRouter::route(const char* topic, const char* payload,
+                                           const Command** command, long* value) const
+{
+    ASSERT(topic != NULL);
+    ASSERT(payload != NULL);
+    ASSERT(command != NULL);
+    ASSERT(value != NULL);
+
+    *command = NULL;
+    if (strncmp(topic, this->prefix_, this->prefix_length_) != 0)
+    {
+        return ROUTE_OTHER_TOPIC;
+    }
+
+    const char* name = topic + this->prefix_length_;
+    uint8_t     idx  = this->slots_[slot(name, this->seed_)];
+    if (idx == EMPTY || strcmp(this->commands_[idx].name, name) != 0)
+    {
+        return ROUTE_UNKNOWN_COMMAND;
+    }
+
+    *command = &this->commands_[idx];
+    if (!parseLong(payload, value) || *value < (*command)->min_value || *value > (*command)->max_value)
+    {
+        return ROUTE_INVALID_ARGUMENT;
+    }
+
+    (*command)->handler(*value);
+    return ROUTE_OK;
+}
+
+bool CommandRouter::parseLong(const char* text, long* value)
+{
+    bool negative = (*text == '-');
+    if (*text == '-' || *text == '+')
+    {
+        text++;
+    }
+    if (*text == '\0')
+    {
+        return false;
+    }
+
+    unsigned long limit  = negative ? (unsigned long) LONG_MAX + 1 : LONG_MAX;
+    unsigned long result = 0;
+    for (; *text != '\0'; text++)
+    {
+        if (*text < '0' || *text > '9')
+        {
+            return false;
+        }
+        uint8_t digit = *text - '0';
+        if (result > (limit - digit) / 10)
+        {
+            return false;
+        }
+        result = result * 10 + digit;
+    }
+    *value = negative ? (long) (0 - result) : (long) result;
+    return true;
+}
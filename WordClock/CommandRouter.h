@@ -0,0 +1,95 @@
+#ifndef __COMMANDROUTER_H
+#define __COMMANDROUTER_H
+
+#include <Arduino.h>
+
+// Dispatches command messages ("<prefix><command>", payload = integer argument) to the handlers of a static table.
+// The table is indexed by a collision free hash of the command names, so routing a message costs one prefix
+// compare, one hash, one string compare and the parsing of the argument, and never touches the heap.
+//
+// The seed that makes the hash collision free is found offline ('wordclock_sim --router-seed', see host/) and
+// given to the constructor, which only fills the slots. A constexpr table can check its seed at compile time:
+//
+//     static_assert(CommandRouter::isPerfect(COMMANDS, COUNT, SEED), "...");
+
+class CommandRouter
+{
+
+public:
+
+    typedef void (*Handler)(long value);
+
+    typedef struct {
+        const char* name;         // topic after the prefix, e.g. "brightness"
+        const char* description;  // for log messages
+        long        min_value;    // valid range of the argument
+        long        max_value;
+        Handler     handler;
+    } Command;
+
+    typedef enum {
+        ROUTE_OK               = 0,  // handler called
+        ROUTE_OTHER_TOPIC      = 1,  // the topic does not start with the prefix
+        ROUTE_UNKNOWN_COMMAND  = 2,
+        ROUTE_INVALID_ARGUMENT = 3   // not an integer, or out of range
+    } Result;
+
+    static const uint8_t MAX_COMMANDS = 16;
+
+    // 'prefix' and 'commands' are not copied; 'seed' must be perfect for the commands (see isPerfect())
+    CommandRouter(const char* prefix, const Command* commands, uint8_t count, uint32_t seed);
+
+    // finds the command of 'topic', parses and checks 'payload' and calls the handler. 'command' and 'value' are
+    // set as far as known (command for ROUTE_OK and ROUTE_INVALID_ARGUMENT, value for ROUTE_OK).
+    Result route(const char* topic, const char* payload, const Command** command, long* value) const;
+
+    // strict decimal integer: optional sign, digits only, no overflow
+    static bool parseLong(const char* text, long* value);
+
+    static const uint8_t SLOTS = 2 * MAX_COMMANDS;  // power of 2
+
+    // FNV-1a, the seed mixed into the offset basis
+    static constexpr uint32_t hash(const char* name, uint32_t seed)
+    {
+        return hashFrom(name, 2166136261u ^ seed);
+    }
+
+    static constexpr uint8_t slot(const char* name, uint32_t seed)
+    {
+        return hash(name, seed) % SLOTS;
+    }
+
+    // no two of the commands share a slot with 'seed'
+    static constexpr bool isPerfect(const Command* commands, uint8_t count, uint32_t seed, uint8_t i = 0)
+    {
+        return count <= MAX_COMMANDS &&
+               (i >= count || (!sharesSlot(commands, count, seed, i, i + 1) && isPerfect(commands, count, seed, i + 1)));
+    }
+
+private:
+
+    static const uint8_t EMPTY = 0xFF;
+
+    const char*    prefix_;
+    uint8_t        prefix_length_;
+    const Command* commands_;
+    uint8_t        count_;
+    uint32_t       seed_;
+    uint8_t        slots_[SLOTS];  // command index per hash value
+
+    // recursive, as a constexpr function of C++11 has to be
+    static constexpr uint32_t hashFrom(const char* name, uint32_t h)
+    {
+        return (*name == '\0') ? h : hashFrom(name + 1, (h ^ (uint8_t) *name) * 16777619u);
+    }
+
+    // command i shares its slot with one of the commands j..count-1
+    static constexpr bool sharesSlot(const Command* commands, uint8_t count, uint32_t seed, uint8_t i, uint8_t j)
+    {
+        return j < count && (slot(commands[i].name, seed) == slot(commands[j].name, seed) ||
+                             sharesSlot(commands, count, seed, i, j + 1));
+    }
+
+};
+
+#endif  // __COMMANDROUTER_H
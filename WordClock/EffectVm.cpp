@@ -0,0 +1,306 @@
+#include "EffectVm.h"
+
+
+const EffectVm::OpInfo EffectVm::OP_INFO[OP_COUNT] = {
+    // pops pushes operand
+    { 0, 0, 0 },  // OP_END
+    { 0, 1, 4 },  // OP_PUSH
+    { 0, 1, 1 },  // OP_PUSHI
+    { 0, 1, 1 },  // OP_LOAD
+    { 1, 0, 1 },  // OP_STORE
+    { 1, 2, 0 },  // OP_DUP
+    { 1, 0, 0 },  // OP_DROP
+    { 2, 2, 0 },  // OP_SWAP
+    { 2, 3, 0 },  // OP_OVER
+    { 2, 1, 0 },  // OP_ADD
+    { 2, 1, 0 },  // OP_SUB
+    { 2, 1, 0 },  // OP_MUL
+    { 2, 1, 0 },  // OP_DIV
+    { 2, 1, 0 },  // OP_MIN
+    { 2, 1, 0 },  // OP_MAX
+    { 2, 1, 0 },  // OP_LT
+    { 2, 1, 0 },  // OP_EQ
+    { 1, 1, 0 },  // OP_NEG
+    { 1, 1, 0 },  // OP_ABS
+    { 1, 1, 0 },  // OP_FRAC
+    { 1, 1, 0 },  // OP_SIN
+    { 1, 1, 0 },  // OP_CLAMP
+    { 3, 1, 0 },  // OP_LERP
+    { 3, 1, 0 },  // OP_SEL
+    { 1, 3, 0 },  // OP_HUE
+    { 1, 0, 1 },  // OP_JZ
+    { 0, 0, 1 }   // OP_JMP
+};
+
+// sin() of the first quarter turn in 64 steps, Q16.16
+static const int32_t QUARTER_SINE[65] = {
+        0,  1608,  3216,  4821,  6424,  8022,  9616, 11204, 12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+    25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062, 36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190,
+    46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581, 54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+    60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944, 64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516,
+    65536
+};
+
+
+EffectVm::Program EffectVm::none()
+{
+    Program program;
+    memset(&program, 0, sizeof(program));
+    program.kind         = KIND_NONE;
+    program.size         = 1;
+    program.instructions = 1;
+    program.code[0]      = OP_END;
+    return program;
+}
+
+const char* EffectVm::load(const uint8_t* data, uint16_t size, Program* program)
+{
+    if (size < HEADER_SIZE || data[0] != 'F' || data[1] != 'X')
+        return "not an effect";
+    if (data[2] != VERSION)
+        return "unsupported version";
+    if (data[3] != KIND_SPLASH && data[3] != KIND_TRANSITION)
+        return "unknown kind";
+    const uint8_t* code = &data[HEADER_SIZE];
+    uint16_t code_size  = size - HEADER_SIZE;
+    if (code_size == 0 || code_size > MAX_CODE)
+        return "code size out of range";
+
+    // One pass suffices, since jumps only go forward: the stack depth at every instruction is known from the one
+    // before it or from the jumps to it, which were all seen before. -1: nothing leads there (yet).
+    int8_t depth_at[MAX_CODE];
+    memset(depth_at, -1, sizeof(depth_at));
+    int16_t  depth        = 0;      // -1 after an unconditional jump or END
+    uint16_t instructions = 0;
+    uint16_t pc           = 0;
+    while (pc < code_size)
+    {
+        uint8_t op = code[pc];
+        if (depth_at[pc] >= 0)
+        {
+            if (depth >= 0 && depth != depth_at[pc])
+                return "stack depth differs between the paths to an instruction";
+            depth = depth_at[pc];
+        }
+        if (depth < 0)
+            return "unreachable code";
+        if (op >= OP_COUNT)
+            return "unknown instruction";
+        const OpInfo& info = OP_INFO[op];
+        if (pc + 1 + info.operand > code_size)
+            return "operand beyond the end";
+        for (uint8_t i = 1; i <= info.operand; i++)
+        {
+            if (depth_at[pc + i] >= 0)
+                return "jump into the operand of an instruction";
+        }
+        uint8_t operand = (info.operand > 0) ? code[pc + 1] : 0;
+        if ((op == OP_LOAD && operand >= VAR_COUNT) || (op == OP_STORE && (operand < VAR_R || operand >= VAR_COUNT)))
+            return "variable not readable / writable";
+
+        if (depth < info.pops)
+            return "stack underflow";
+        depth += info.pushes - info.pops;
+        if (depth > STACK_SIZE)
+            return "stack overflow";
+        instructions++;
+
+        uint16_t next = pc + 1 + info.operand;
+        if (op == OP_JZ || op == OP_JMP)
+        {
+            uint16_t target = next + operand;
+            if (target >= code_size)
+                return "jump beyond the end";
+            if (depth_at[target] >= 0 && depth_at[target] != depth)
+                return "stack depth differs between the paths to an instruction";
+            depth_at[target] = depth;
+        }
+        if (op == OP_JMP || op == OP_END)
+            depth = -1;
+        pc = next;
+    }
+    if (depth >= 0)
+        return "no END at the end";
+    if (instructions > MAX_INSTRUCTIONS)
+        return "too long for the budget of a frame";
+
+    uint16_t duration_ms = data[4] | (data[5] << 8);
+    *program      = none();
+    program->kind = data[3];
+    if (duration_ms == 0)
+    {
+        return NULL;  // removes the effect of this kind
+    }
+    program->duration_ms  = duration_ms;
+    program->size         = code_size;
+    program->instructions = instructions;
+    memcpy(program->code, code, code_size);
+    return NULL;
+}
+
+void EffectVm::run(const Program& program, int32_t* vars)
+{
+    // The operations wrap around in unsigned arithmetic, signed overflow would be undefined.
+    int32_t        stack[STACK_SIZE];
+    int32_t*       sp = stack;  // the next free slot, the top is sp[-1]
+    const uint8_t* pc = program.code;
+    vars[VAR_V0] = vars[VAR_V1] = vars[VAR_V2] = vars[VAR_V3] = 0;
+    while (true)
+    {
+        switch (*pc++)
+        {
+        case OP_END:
+            return;
+        case OP_PUSH:
+            *sp++ = (int32_t) (pc[0] | (pc[1] << 8) | (pc[2] << 16) | ((uint32_t) pc[3] << 24));
+            pc += 4;
+            break;
+        case OP_PUSHI:
+            *sp++ = (int32_t) ((uint32_t) (int8_t) *pc++ << 16);
+            break;
+        case OP_LOAD:
+            *sp++ = vars[*pc++];
+            break;
+        case OP_STORE:
+            vars[*pc++] = *--sp;
+            break;
+        case OP_DUP:
+            sp[0] = sp[-1];
+            sp++;
+            break;
+        case OP_DROP:
+            sp--;
+            break;
+        case OP_SWAP:
+        {
+            int32_t a = sp[-2];
+            sp[-2] = sp[-1];
+            sp[-1] = a;
+            break;
+        }
+        case OP_OVER:
+            sp[0] = sp[-2];
+            sp++;
+            break;
+        case OP_ADD:
+            sp--;
+            sp[-1] = (int32_t) ((uint32_t) sp[-1] + (uint32_t) sp[0]);
+            break;
+        case OP_SUB:
+            sp--;
+            sp[-1] = (int32_t) ((uint32_t) sp[-1] - (uint32_t) sp[0]);
+            break;
+        case OP_MUL:
+            sp--;
+            sp[-1] = (int32_t) (((int64_t) sp[-1] * sp[0]) >> 16);
+            break;
+        case OP_DIV:
+        {
+            sp--;
+            int64_t a = sp[-1];
+            int64_t b = sp[0];
+            int64_t q = (b != 0) ? a * ONE / b : (a > 0) ? INT32_MAX : (a < 0) ? -INT32_MAX : 0;
+            sp[-1] = (q > INT32_MAX) ? INT32_MAX : (q < -INT32_MAX) ? -INT32_MAX : (int32_t) q;
+            break;
+        }
+        case OP_MIN:
+            sp--;
+            sp[-1] = (sp[0] < sp[-1]) ? sp[0] : sp[-1];
+            break;
+        case OP_MAX:
+            sp--;
+            sp[-1] = (sp[0] > sp[-1]) ? sp[0] : sp[-1];
+            break;
+        case OP_LT:
+            sp--;
+            sp[-1] = (sp[-1] < sp[0]) ? ONE : 0;
+            break;
+        case OP_EQ:
+            sp--;
+            sp[-1] = (sp[-1] == sp[0]) ? ONE : 0;
+            break;
+        case OP_NEG:
+            sp[-1] = (int32_t) (0u - (uint32_t) sp[-1]);
+            break;
+        case OP_ABS:
+            if (sp[-1] < 0)
+                sp[-1] = (int32_t) (0u - (uint32_t) sp[-1]);
+            break;
+        case OP_FRAC:
+            sp[-1] &= ONE - 1;
+            break;
+        case OP_SIN:
+            sp[-1] = sine(sp[-1]);
+            break;
+        case OP_CLAMP:
+            sp[-1] = (sp[-1] < 0) ? 0 : (sp[-1] > ONE) ? ONE : sp[-1];
+            break;
+        case OP_LERP:
+            sp -= 2;
+            sp[-1] = (int32_t) (sp[-1] + ((((int64_t) sp[0] - sp[-1]) * sp[1]) >> 16));
+            break;
+        case OP_SEL:
+            sp -= 2;
+            sp[-1] = (sp[-1] != 0) ? sp[0] : sp[1];
+            break;
+        case OP_HUE:
+            hue(sp[-1], &sp[-1]);
+            sp += 2;
+            break;
+        case OP_JZ:
+            if (*--sp == 0)
+                pc += *pc;
+            pc++;
+            break;
+        case OP_JMP:
+            pc += *pc + 1;
+            break;
+        default:
+            return;  // not in a program from load()
+        }
+    }
+}
+
+// ----- private methods -----
+
+
+int32_t EffectVm::sine(int32_t turns)
+{
+    // the quarter of the turn selects the mirroring of the table
+    uint16_t position = turns & (ONE - 1);
+    uint16_t in_quarter = position & 0x3FFF;
+    switch (position >> 14)
+    {
+    case 0:  return  quarterSine(in_quarter);
+    case 1:  return  quarterSine(0x4000 - in_quarter);
+    case 2:  return -quarterSine(in_quarter);
+    default: return -quarterSine(0x4000 - in_quarter);
+    }
+}
+
+int32_t EffectVm::quarterSine(uint16_t position)
+{
+    // 0..0x4000 is the quarter turn, linearly interpolated between the 64 steps of the table
+    uint8_t i    = position >> 8;
+    int32_t rest = position & 0xFF;
+    if (i == 64)
+        return QUARTER_SINE[64];
+    return QUARTER_SINE[i] + (((QUARTER_SINE[i + 1] - QUARTER_SINE[i]) * rest) >> 8);
+}
+
+void EffectVm::hue(int32_t h, int32_t* rgb)
+{
+    // six sectors, in each one channel rises or falls linearly
+    uint32_t scaled = (uint32_t) (h & (ONE - 1)) * 6;
+    int32_t  rising  = scaled & (ONE - 1);
+    int32_t  falling = ONE - rising;
+    switch (scaled >> 16)
+    {
+    case 0:  rgb[0] = ONE;     rgb[1] = rising;  rgb[2] = 0;       break;
+    case 1:  rgb[0] = falling; rgb[1] = ONE;     rgb[2] = 0;       break;
+    case 2:  rgb[0] = 0;       rgb[1] = ONE;     rgb[2] = rising;  break;
+    case 3:  rgb[0] = 0;       rgb[1] = falling; rgb[2] = ONE;     break;
+    case 4:  rgb[0] = rising;  rgb[1] = 0;       rgb[2] = ONE;     break;
+    default: rgb[0] = ONE;     rgb[1] = 0;       rgb[2] = falling; break;
+    }
+}
@@ -0,0 +1,172 @@
+#ifndef __EFFECTVM_H
+#define __EFFECTVM_H
+
+#include <Arduino.h>
+
+#include "configuration.h"
+
+// Effects uploaded at runtime (over mqtt, see WordClock.ino) instead of compiled into the firmware: a small stack
+// machine program that runs once per pixel and frame and computes the pixel's color. host/effect_asm.h assembles
+// programs from text, host/effects/ has examples.
+//
+// A program is a header ('F', 'X', version, kind, duration [ms] as 16 bit little endian) followed by the code.
+// There are two kinds:
+//
+//  - splash: a splash screen (LedMatrix::setSplashScreen(2)), runs over all pixels for the duration.
+//  - transition: a time transition (LedMatrix::setTransition()), runs over the pixels that change, each for the
+//    duration since it began to change, then the pixel is set to its final color. So a transition always ends on
+//    the new time, whatever the program does.
+//
+// Values are fixed point numbers Q16.16 (ONE = 1.0), colors are 0..ONE per channel. The program reads the
+// variables (VAR_*) of its pixel, computes on a stack and writes the color to VAR_R, VAR_G and VAR_B, which start
+// as the pixel's current color. Arithmetic wraps around instead of trapping, a division by 0 saturates.
+//
+// The sandbox is checked once, by load(): only known instructions and variables, no variable written that is an
+// input, jumps only forward and onto an instruction, a stack that neither underflows nor grows beyond STACK_SIZE
+// and is equally deep on every path to an instruction, and an END at the end. So a program cannot loop and runs at
+// most as many instructions as it has; load() rejects programs that would take more than FRAME_BUDGET
+// instructions for a frame of all pixels. run() does not check anything again.
+
+class EffectVm
+{
+
+public:
+
+    typedef enum {
+        KIND_NONE       = 0,  // no program, see Program
+        KIND_SPLASH     = 1,
+        KIND_TRANSITION = 2
+    } Kind;
+
+    // instructions; 'a b -> c' pops b (the top), then a, and pushes c
+    typedef enum {
+        OP_END   = 0,   // ends the program for this pixel
+        OP_PUSH  = 1,   // (4 bytes Q16.16, little endian)  -> v
+        OP_PUSHI = 2,   // (1 byte, signed integer)         -> v
+        OP_LOAD  = 3,   // (1 byte variable)                -> v
+        OP_STORE = 4,   // (1 byte variable)              v ->
+        OP_DUP   = 5,   //    a -> a a
+        OP_DROP  = 6,   //    a ->
+        OP_SWAP  = 7,   //  a b -> b a
+        OP_OVER  = 8,   //  a b -> a b a
+        OP_ADD   = 9,   //  a b -> a + b
+        OP_SUB   = 10,  //  a b -> a - b
+        OP_MUL   = 11,  //  a b -> a * b
+        OP_DIV   = 12,  //  a b -> a / b
+        OP_MIN   = 13,  //  a b -> min(a, b)
+        OP_MAX   = 14,  //  a b -> max(a, b)
+        OP_LT    = 15,  //  a b -> a < b ? ONE : 0
+        OP_EQ    = 16,  //  a b -> a == b ? ONE : 0
+        OP_NEG   = 17,  //    a -> -a
+        OP_ABS   = 18,  //    a -> |a|
+        OP_FRAC  = 19,  //    a -> a - floor(a)
+        OP_SIN   = 20,  //    a -> sin(2 pi a)
+        OP_CLAMP = 21,  //    a -> a limited to 0..ONE
+        OP_LERP  = 22,  // a b t -> a + (b - a) * t
+        OP_SEL   = 23,  // c a b -> c != 0 ? a : b
+        OP_HUE   = 24,  //    h -> r g b (fully saturated, h 0..ONE is the color circle, wraps around)
+        OP_JZ    = 25,  // (1 byte offset) c -> ; skips the offset's number of bytes after it if c == 0
+        OP_JMP   = 26,  // (1 byte offset)   -> ; skips the offset's number of bytes after it
+        OP_COUNT = 27
+    } Opcode;
+
+    // the variables of a pixel; the time related ones are seconds (VAR_T, since the effect or the pixel began) or
+    // fractions 0..ONE, coordinates and VAR_LIT are integers
+    typedef enum {
+        VAR_X        = 0,   // column, 0 is left
+        VAR_Y        = 1,   // row, 0 is at the top
+        VAR_T        = 2,   // seconds since the splash began / since the pixel began to change
+        VAR_PROGRESS = 3,   // VAR_T as a fraction of the duration
+        VAR_PHASE    = 4,   // fraction of the current second that has passed
+        VAR_LIT      = 5,   // 1 if the pixel is part of the time's words, else 0
+        VAR_RAND     = 6,   // random 0..ONE, new for every pixel and frame
+        VAR_FROM_R   = 7,   // the color the pixel had when the splash / its change began
+        VAR_FROM_G   = 8,
+        VAR_FROM_B   = 9,
+        VAR_TO_R     = 10,  // the color the pixel has in the time display (the word color or black)
+        VAR_TO_G     = 11,
+        VAR_TO_B     = 12,
+        VAR_R        = 13,  // the pixel's color, the program's result; the first variable it may write
+        VAR_G        = 14,
+        VAR_B        = 15,
+        VAR_V0       = 16,  // scratch, 0 at the start of every pixel
+        VAR_V1       = 17,
+        VAR_V2       = 18,
+        VAR_V3       = 19,
+        VAR_COUNT    = 20
+    } Var;
+
+    static const int32_t  ONE              = 0x10000;
+    static const uint8_t  VERSION          = 1;
+    static const uint8_t  HEADER_SIZE      = 6;
+    static const uint16_t MAX_CODE         = 192;    // bytes; an upload must fit into the mqtt client's buffer
+    static const uint8_t  STACK_SIZE       = 16;
+    static const uint32_t FRAME_BUDGET     = 16384;  // instructions for a frame of all pixels (about 1 ms on the esp32)
+    static const uint16_t MAX_INSTRUCTIONS = FRAME_BUDGET / (MATRIX_WIDTH * MATRIX_HEIGHT);
+
+    typedef struct {
+        uint8_t  kind;
+        uint16_t duration_ms;    // 0 for an empty program, its code is a single OP_END
+        uint16_t size;           // of the code
+        uint16_t instructions;   // in the code, the most that run for a pixel
+        uint8_t  code[MAX_CODE];
+    } Program;
+
+    // an empty program, of no kind
+    static Program none();
+
+    // checks an uploaded program (header and code) and copies it to 'program'. Returns NULL if it is valid, else
+    // what is wrong with it ('program' is unchanged then). A valid program with a duration of 0 yields an empty one
+    // of its kind, for removing the effect of that kind.
+    static const char* load(const uint8_t* data, uint16_t size, Program* program);
+
+    // runs 'program' (from load()) for one pixel: 'vars' holds its variables, the program leaves the color in
+    // VAR_R, VAR_G and VAR_B
+    static void run(const Program& program, int32_t* vars);
+
+    // conversions to and from Q16.16; a channel is 16 bits like in the FrameBuffer, 0..65535 maps to 0..ONE, and
+    // back to the same value
+    static int32_t fromChannel(uint16_t value)
+    {
+        return value + (value >> 15);
+    }
+
+    static uint16_t toChannel(int32_t value)
+    {
+        if (value <= 0)
+            return 0;
+        if (value >= ONE)
+            return 0xFFFF;
+        return value - (value >> 15);
+    }
+
+    static int32_t fromMillis(uint32_t ms)
+    {
+        return (int32_t) (((uint64_t) ms << 16) / 1000);
+    }
+
+    // part / whole, at most ONE; ONE if 'whole' is 0
+    static int32_t fraction(uint32_t part, uint32_t whole)
+    {
+        if (part >= whole)
+            return ONE;
+        return (int32_t) (((uint64_t) part << 16) / whole);
+    }
+
+private:
+
+    typedef struct {
+        uint8_t pops;
+        uint8_t pushes;
+        uint8_t operand;  // bytes after the opcode
+    } OpInfo;
+
+    static const OpInfo OP_INFO[OP_COUNT];
+
+    static int32_t sine(int32_t turns);
+    static int32_t quarterSine(uint16_t position);
+    static void hue(int32_t h, int32_t* rgb);
+
+};
+
+#endif  // __EFFECTVM_H
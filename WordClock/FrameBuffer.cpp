@@ -0,0 +1,65 @@
+#include "FrameBuffer.h"
+
+#include "assertions.h"
+
+
+FrameBuffer::FrameBuffer()
+{
+    memset(this->pixels_, 0, sizeof(this->pixels_));
+    this->changed_       = true;
+    this->gamma_enabled_ = true;
+    // the only floating point: once, not on the render path
+    for (uint16_t i = 0; i < LUT_SIZE; i++)
+    {
+        this->curve_[i] = (uint16_t) (powf((float) i / (LUT_SIZE - 1), MATRIX_LED_GAMMA) * 65535.0f + 0.5f);
+    }
+    setBrightness(255);
+}
+
+void FrameBuffer::setPixel(uint16_t index, const Color& color)
+{
+    ASSERT(index < PIXELS);
+    this->pixels_[index] = color;
+    this->changed_       = true;
+}
+
+void FrameBuffer::setPixel(uint16_t index, const RgbColor& color)
+{
+    setPixel(index, fromRgb(color));
+}
+
+FrameBuffer::Color FrameBuffer::getPixel(uint16_t index) const
+{
+    ASSERT(index < PIXELS);
+    return this->pixels_[index];
+}
+
+void FrameBuffer::clearTo(const RgbColor& color)
+{
+    Color value = fromRgb(color);
+    for (uint16_t i = 0; i < PIXELS; i++)
+    {
+        this->pixels_[i] = value;
+    }
+    this->changed_ = true;
+}
+
+void FrameBuffer::setBrightness(uint8_t brightness)
+{
+    // rounded, so at full brightness without gamma every 8 bit color comes out as it went in
+    for (uint16_t i = 0; i < LUT_SIZE; i++)
+    {
+        this->gamma_lut_[i]  = ((uint32_t) this->curve_[i] * brightness + 32767) / 65535;
+        this->linear_lut_[i] = ((uint32_t) i * brightness + (LUT_SIZE - 1) / 2) / (LUT_SIZE - 1);
+    }
+    this->changed_ = true;
+}
+
+void FrameBuffer::setGamma(bool enabled)
+{
+    if (enabled != this->gamma_enabled_)
+    {
+        this->gamma_enabled_ = enabled;
+        this->changed_       = true;
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef __FRAMEBUFFER_H
+#define __FRAMEBUFFER_H
+
+#include <Arduino.h>
+#include <NeoPixelBus.h>  // RgbColor
+
+#include "configuration.h"
+
+// The colors the effects draw and read back, at 16 bits per channel and full brightness, by led index like the bus.
+// The bus only holds 8 bits already dimmed to the brightness (at the default of 13 barely 4 bits), so colors read
+// back from it had lost almost all precision, and every set and get scaled. Here nothing is scaled until the output
+// stage: output() maps each channel through a table of brightness x gamma, once per frame, into the bus.
+//
+// Plain 8 bit colors (RgbColor) go in and out as 0..255 of the full range, a value c as c * 257.
+
+class FrameBuffer
+{
+
+public:
+
+    typedef struct {
+        uint16_t R;
+        uint16_t G;
+        uint16_t B;
+    } Color;
+
+    static const uint16_t PIXELS   = MATRIX_WIDTH * MATRIX_HEIGHT;
+    static const uint8_t  LUT_BITS = 10;  // the output tables are indexed by the upper bits of a channel
+
+    FrameBuffer();
+
+    void setPixel(uint16_t index, const Color& color);
+    void setPixel(uint16_t index, const RgbColor& color);
+    Color getPixel(uint16_t index) const;
+    void clearTo(const RgbColor& color);
+
+    // the output stage; both changes take effect with the next output()
+    void setBrightness(uint8_t brightness);
+    void setGamma(bool enabled);  // off for colors that are already corrected (e.g. the pixel stream's)
+
+    // something changed since the last output()
+    bool isChanged() const
+    {
+        return this->changed_;
+    }
+
+    // writes every pixel into 'bus' as the leds show it: dimmed and gamma corrected
+    template<typename T_BUS> void output(T_BUS& bus)
+    {
+        const uint8_t* lut = this->gamma_enabled_ ? this->gamma_lut_ : this->linear_lut_;
+        for (uint16_t i = 0; i < PIXELS; i++)
+        {
+            const Color& color = this->pixels_[i];
+            bus.SetPixelColor(i, RgbColor(lut[color.R >> (16 - LUT_BITS)], lut[color.G >> (16 - LUT_BITS)],
+                                          lut[color.B >> (16 - LUT_BITS)]));
+        }
+        this->changed_ = false;
+    }
+
+    static Color fromRgb(const RgbColor& color)
+    {
+        return { (uint16_t) (color.R * 257), (uint16_t) (color.G * 257), (uint16_t) (color.B * 257) };
+    }
+
+    static RgbColor toRgb(const Color& color)
+    {
+        return RgbColor((color.R + 128) / 257, (color.G + 128) / 257, (color.B + 128) / 257);
+    }
+
+    static bool equal(const Color& a, const Color& b)
+    {
+        return a.R == b.R && a.G == b.G && a.B == b.B;
+    }
+
+private:
+
+    static const uint16_t LUT_SIZE = 1 << LUT_BITS;
+
+    Color    pixels_[PIXELS];
+    bool     changed_;
+    bool     gamma_enabled_;
+    uint16_t curve_[LUT_SIZE];        // the gamma curve at full brightness, 0..65535
+    uint8_t  gamma_lut_[LUT_SIZE];    // curve_ at the brightness
+    uint8_t  linear_lut_[LUT_SIZE];   // the brightness alone
+
+};
+
+#endif  // __FRAMEBUFFER_H
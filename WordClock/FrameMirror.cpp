@@ -0,0 +1,208 @@
+#include "FrameMirror.h"
+
+#include "assertions.h"
+#include "LedMapping.h"
+
+
+FrameMirror::FrameMirror(uint32_t interval_ms, uint32_t keyframe_interval_ms) :
+  interval_ms_(interval_ms),
+  keyframe_interval_ms_(keyframe_interval_ms),
+  latest_(blackFrame()),
+  pending_(false),
+  keyframe_requested_(true),
+  last_message_ms_(0),
+  last_keyframe_ms_(0),
+  sequence_(0),
+  messages_(0),
+  keyframes_(0),
+  bytes_(0)
+{
+    memset(this->sent_, 0, sizeof(this->sent_));
+}
+
+void FrameMirror::offer(const uint8_t* leds)
+{
+    // the render task is the only writer: no mutex, one copy
+    memcpy(this->latest_.writeBuffer().pixels, leds, sizeof(LedFrame::pixels));
+    this->latest_.publish();
+}
+
+uint16_t FrameMirror::poll(uint8_t* message, uint16_t size)
+{
+    ASSERT(size >= MAX_MESSAGE_SIZE);
+
+    bool fresh;
+    const LedFrame& frame = this->latest_.read(&fresh);
+    this->pending_ |= fresh;
+
+    uint32_t now = millis();
+    bool keyframe = this->keyframe_requested_ || now - this->last_keyframe_ms_ >= this->keyframe_interval_ms_;
+    if ((!this->pending_ && !keyframe) || (this->messages_ > 0 && now - this->last_message_ms_ < this->interval_ms_))
+    {
+        return 0;
+    }
+
+    uint8_t rgb[CHANNELS];
+    toRgb(frame, rgb);
+    this->pending_ = false;
+    if (!keyframe && memcmp(rgb, this->sent_, CHANNELS) == 0)
+    {
+        return 0;  // the frames since the last message led back to it
+    }
+
+    uint16_t length = encodeKeyframe(rgb, message);
+    if (!keyframe)
+    {
+        uint16_t delta = encodeDelta(rgb, this->delta_, length - 1);
+        if (delta > 0)
+        {
+            memcpy(message, this->delta_, delta);
+            length = delta;
+        }
+        else
+        {
+            keyframe = true;
+        }
+    }
+    if (keyframe)
+    {
+        this->keyframe_requested_ = false;
+        this->last_keyframe_ms_   = now;
+        this->keyframes_++;
+    }
+    message[1] = this->sequence_++;
+
+    memcpy(this->sent_, rgb, CHANNELS);
+    this->last_message_ms_ = now;
+    this->messages_++;
+    this->bytes_ += length;
+    return length;
+}
+
+void FrameMirror::requestKeyframe()
+{
+    this->keyframe_requested_ = true;
+}
+
+uint32_t FrameMirror::getMessages() const
+{
+    return this->messages_;
+}
+
+uint32_t FrameMirror::getKeyframes() const
+{
+    return this->keyframes_;
+}
+
+uint32_t FrameMirror::getBytes() const
+{
+    return this->bytes_;
+}
+
+// ----- private methods -----
+
+
+FrameMirror::LedFrame FrameMirror::blackFrame()
+{
+    LedFrame frame;
+    memset(&frame, 0, sizeof(frame));  // setup() clears the leds
+    return frame;
+}
+
+void FrameMirror::toRgb(const LedFrame& frame, uint8_t* rgb)
+{
+    for (uint8_t y = 0; y < MATRIX_HEIGHT; y++)
+    {
+        for (uint8_t x = 0; x < MATRIX_WIDTH; x++)
+        {
+            const uint8_t* grb = &frame.pixels[LedMapping::index(x, y) * 3];
+            *rgb++ = grb[1];
+            *rgb++ = grb[0];
+            *rgb++ = grb[2];
+        }
+    }
+}
+
+uint16_t FrameMirror::encodeKeyframe(const uint8_t* rgb, uint8_t* message)
+{
+    // palette in the order the colors turn up, the index of every pixel meanwhile
+    uint8_t* palette = &message[3];
+    uint8_t  colors  = 0;
+    uint8_t  indices[LED_CNT];
+    for (uint16_t p = 0; p < LED_CNT; p++, rgb += 3)
+    {
+        uint8_t i = 0;
+        while (i < colors && memcmp(&palette[i * 3], rgb, 3) != 0)
+        {
+            i++;
+        }
+        if (i == colors)
+        {
+            memcpy(&palette[colors++ * 3], rgb, 3);
+        }
+        indices[p] = i;
+    }
+
+    uint8_t bits = (colors <= 1) ? 0 : (colors <= 2) ? 1 : (colors <= 4) ? 2 : (colors <= 16) ? 4 : 8;
+    uint8_t* packed = &palette[colors * 3];
+    uint16_t packed_size = (LED_CNT * bits + 7) / 8;
+    memset(packed, 0, packed_size);
+    for (uint16_t p = 0; p < LED_CNT && bits > 0; p++)
+    {
+        uint16_t bit = p * bits;
+        packed[bit / 8] |= indices[p] << (8 - bits - bit % 8);
+    }
+
+    message[0] = TYPE_KEYFRAME;
+    message[2] = colors;
+    return 3 + colors * 3 + packed_size;
+}
+
+uint16_t FrameMirror::encodeDelta(const uint8_t* rgb, uint8_t* message, uint16_t limit)
+{
+    // returns 0 if the delta would take more than 'limit' bytes
+    uint16_t length = 2;
+    uint16_t i      = 0;
+    message[0] = TYPE_DELTA;
+    while (i < CHANNELS)
+    {
+        uint16_t unchanged = 0;
+        while (i + unchanged < CHANNELS && rgb[i + unchanged] == this->sent_[i + unchanged])
+        {
+            unchanged++;
+        }
+        if (i + unchanged == CHANNELS)
+        {
+            break;  // the rest is unchanged
+        }
+        if (unchanged >= 2)  // a single unchanged byte costs less within a run of changed ones than as a token
+        {
+            i += unchanged;
+            while (unchanged > 0)
+            {
+                uint16_t n = (unchanged < 128) ? unchanged : 128;
+                if (length + 1 > limit)
+                    return 0;
+                message[length++] = n - 1;
+                unchanged -= n;
+            }
+            continue;
+        }
+
+        uint16_t changed = 0;
+        while (i + changed < CHANNELS && changed < 128 &&
+               (rgb[i + changed] != this->sent_[i + changed] ||
+                (i + changed + 1 < CHANNELS && rgb[i + changed + 1] != this->sent_[i + changed + 1])))
+        {
+            changed++;
+        }
+        if (length + 1 + changed > limit)
+            return 0;
+        message[length++] = 0x7F + changed;
+        for (uint16_t c = 0; c < changed; c++, i++)
+        {
+            message[length++] = rgb[i] ^ this->sent_[i];
+        }
+    }
+    return length;
+}
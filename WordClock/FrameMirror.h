@@ -0,0 +1,81 @@
+#ifndef __FRAMEMIRROR_H
+#define __FRAMEMIRROR_H
+
+#include <Arduino.h>
+
+#include "LedMatrix.h"
+#include "TripleBuffer.h"
+
+// A compact copy of what the leds show, for watching the clocks from a dashboard (published over mqtt, see
+// WordClock.ino; host/mirror_decoder.h decodes it). The colors are those sent to the leds, i.e. dimmed by the
+// brightness. A frame goes out as one of two kinds of message:
+//
+//  - keyframe: 'K', sequence, palette size n (1..LED_CNT), n colors (r, g, b), then the palette index of every
+//    pixel, row by row from the top left, packed from the most significant bit into 0, 1, 2, 4 or 8 bits, as few
+//    as n needs. A frame of the clock has two colors, so its indices are exactly the WordFrame mask.
+//  - delta: 'D', sequence, then the xor of the frame with the one sent before, as bytes r, g, b per pixel in the
+//    same order, run-length coded: a token t < 0x80 skips t + 1 unchanged bytes, a token t >= 0x80 is followed by
+//    t - 0x7F changed ones. What follows the last token is unchanged.
+//
+// The sequence counts the messages (mod 256), so a receiver notices a lost one and waits for the next keyframe.
+// At most one message goes out per 'interval_ms': the frames in between are coalesced, and a delta always refers
+// to the last frame sent. A keyframe is sent every 'keyframe_interval_ms' (for receivers that join later) and
+// instead of a delta that would not be smaller.
+//
+// The render task offers every frame it sends to the leds, which costs a copy into a triple buffer and no lock.
+// Encoding and sending is left to the publishing task.
+
+class FrameMirror
+{
+
+public:
+
+    static const uint8_t  TYPE_KEYFRAME    = 'K';
+    static const uint8_t  TYPE_DELTA       = 'D';
+    static const uint16_t MAX_MESSAGE_SIZE = 3 + LED_CNT * 3 + LED_CNT;  // keyframe with a color per pixel
+
+    FrameMirror(uint32_t interval_ms, uint32_t keyframe_interval_ms);
+
+    // the frame just sent to the leds, in chain order as on the wire (from the render task)
+    void offer(const uint8_t* leds);
+
+    // the next message into 'message' (at least MAX_MESSAGE_SIZE), if one is due; returns its size, or 0
+    uint16_t poll(uint8_t* message, uint16_t size);
+
+    // the next message will be a keyframe, e.g. after the connection to the broker was lost
+    void requestKeyframe();
+
+    uint32_t getMessages() const;
+    uint32_t getKeyframes() const;
+    uint32_t getBytes() const;   // of all messages
+
+private:
+
+    static const uint16_t CHANNELS = LED_CNT * 3;
+
+    typedef struct {
+        uint8_t pixels[CHANNELS];  // as on the wire
+    } LedFrame;
+
+    uint32_t interval_ms_;
+    uint32_t keyframe_interval_ms_;
+    TripleBuffer<LedFrame> latest_;  // offered by the render task, its only writer
+    uint8_t  sent_[CHANNELS];        // the last frame sent, rgb row by row
+    uint8_t  delta_[MAX_MESSAGE_SIZE];
+    bool     pending_;               // a frame was offered since the last message
+    bool     keyframe_requested_;
+    uint32_t last_message_ms_;
+    uint32_t last_keyframe_ms_;
+    uint8_t  sequence_;
+    uint32_t messages_;
+    uint32_t keyframes_;
+    uint32_t bytes_;
+
+    static LedFrame blackFrame();
+    static void toRgb(const LedFrame& frame, uint8_t* rgb);
+    static uint16_t encodeKeyframe(const uint8_t* rgb, uint8_t* message);
+    uint16_t encodeDelta(const uint8_t* rgb, uint8_t* message, uint16_t limit);
+
+};
+
+#endif  // __FRAMEMIRROR_H
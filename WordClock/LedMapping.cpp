@@ -0,0 +1,91 @@
+
+#include "LedMapping.h"
+
+#include "index_sequence.h"
+
+
+// ----- compile time generation of the mapping -----
+
+namespace {
+
+constexpr bool ROTATED    = (MATRIX_ROTATION == 90) || (MATRIX_ROTATION == 270);
+constexpr int  PANEL_W    = ROTATED ? MATRIX_HEIGHT : MATRIX_WIDTH;  // the matrix as seen by the wiring
+constexpr int  PANEL_H    = ROTATED ? MATRIX_WIDTH  : MATRIX_HEIGHT;
+constexpr bool BY_COLUMNS = (MATRIX_LAYOUT == LAYOUT_COLUMN_MAJOR) || (MATRIX_LAYOUT == LAYOUT_COLUMN_SERPENTINE);
+constexpr bool SERPENTINE = (MATRIX_LAYOUT == LAYOUT_SERPENTINE)   || (MATRIX_LAYOUT == LAYOUT_COLUMN_SERPENTINE);
+constexpr int  LINES      = BY_COLUMNS ? PANEL_W : PANEL_H;  // rows (or columns) the chain runs along
+constexpr int  LINE_LEN   = BY_COLUMNS ? PANEL_H : PANEL_W;
+
+static_assert((MATRIX_LAYOUT >= LAYOUT_ROW_MAJOR) && (MATRIX_LAYOUT <= LAYOUT_COLUMN_SERPENTINE),
+              "MATRIX_LAYOUT must be one of the LAYOUT_* values");
+static_assert((MATRIX_ROTATION == 0) || (MATRIX_ROTATION == 90) || (MATRIX_ROTATION == 180) || (MATRIX_ROTATION == 270),
+              "MATRIX_ROTATION must be 0, 90, 180 or 270");
+static_assert((MATRIX_SEGMENTS > 0) && (LINES % MATRIX_SEGMENTS == 0),
+              "MATRIX_SEGMENTS must divide the rows (columns for the column layouts) evenly");
+
+constexpr int SEGMENT_LINES = LINES / MATRIX_SEGMENTS;
+
+constexpr int mirroredX(int x)
+{
+    return MATRIX_MIRRORED ? MATRIX_WIDTH - 1 - x : x;
+}
+
+constexpr int panelX(int x, int y)
+{
+    return (MATRIX_ROTATION ==  90) ? MATRIX_HEIGHT - 1 - y :
+           (MATRIX_ROTATION == 180) ? MATRIX_WIDTH  - 1 - x :
+           (MATRIX_ROTATION == 270) ? y :
+                                      x;
+}
+
+constexpr int panelY(int x, int y)
+{
+    return (MATRIX_ROTATION ==  90) ? x :
+           (MATRIX_ROTATION == 180) ? MATRIX_HEIGHT - 1 - y :
+           (MATRIX_ROTATION == 270) ? MATRIX_WIDTH  - 1 - x :
+                                      y;
+}
+
+// position 'pos' on line 'line' of the chain; serpentine lines alternate, starting anew in every segment
+constexpr uint16_t chainIndex(int line, int pos)
+{
+    return line * LINE_LEN +
+           ((SERPENTINE && ((line % SEGMENT_LINES) & 0x01)) ? LINE_LEN - 1 - pos : pos);
+}
+
+constexpr uint16_t physicalIndex(int px, int py)
+{
+    return BY_COLUMNS ? chainIndex(px, py) : chainIndex(py, px);
+}
+
+constexpr uint16_t ledIndex(int x, int y)
+{
+    return physicalIndex(panelX(mirroredX(x), y), panelY(mirroredX(x), y));
+}
+
+}  // namespace
+
+template<size_t... I> constexpr LedMapping::Table makeTable(Indices<I...>)
+{
+    return LedMapping::Table{ { ledIndex(I % MATRIX_WIDTH, I / MATRIX_WIDTH)... } };
+}
+
+// index: y * MATRIX_WIDTH + x
+const LedMapping::Table LedMapping::TABLE PROGMEM = makeTable(MakeIndices<MATRIX_WIDTH * MATRIX_HEIGHT>::type());
+
+
+// ----- LedMapping -----
+
+bool LedMapping::isPermutation()
+{
+    const uint16_t count = MATRIX_WIDTH * MATRIX_HEIGHT;
+    bool mapped[count] = {};
+    for (uint16_t i = 0; i < count; i++)
+    {
+        uint16_t led = pgm_read_word(&TABLE.index[i]);
+        if (led >= count || mapped[led])
+            return false;
+        mapped[led] = true;
+    }
+    return true;
+}
@@ -0,0 +1,48 @@
+#ifndef __LEDMAPPING_H
+#define __LEDMAPPING_H
+
+#include <Arduino.h>
+
+#include "configuration.h"
+
+// Maps the logical pixel (x, y) of the letter grid, (0, 0) = top left, to the index of its led in the chain.
+// The wiring is described in configuration.h and resolved at compile time into a table, so a lookup is a single
+// read from flash, whatever the wiring:
+//
+//  - MATRIX_LAYOUT: how the chain runs through a segment, one of the LAYOUT_* values below
+//  - MATRIX_MIRRORED, MATRIX_ROTATION: the wiring as seen from the front, mirrored and/or rotated clockwise
+//    (the layout then refers to the rotated matrix, e.g. its rows are columns of the letter grid at 90 degrees)
+//  - MATRIX_SEGMENTS: the rows (or columns) are split into this many equal segments, each wired like a matrix
+//    of its own, and chained in order. This only makes a difference for the serpentine layouts, where every
+//    segment starts in the same direction.
+
+#define LAYOUT_ROW_MAJOR         0  // every row left to right, top to bottom
+#define LAYOUT_SERPENTINE        1  // rows alternate between left to right and right to left
+#define LAYOUT_COLUMN_MAJOR      2  // every column top to bottom, left to right
+#define LAYOUT_COLUMN_SERPENTINE 3  // columns alternate between top to bottom and bottom to top
+
+class LedMapping
+{
+
+public:
+
+    typedef struct
+    {
+        uint16_t index[MATRIX_WIDTH * MATRIX_HEIGHT];
+    } Table;
+
+    static uint16_t index(uint8_t x, uint8_t y)
+    {
+        return pgm_read_word(&TABLE.index[y * MATRIX_WIDTH + x]);
+    }
+
+    // checks that every led is mapped exactly once (for the host simulation)
+    static bool isPermutation();
+
+private:
+
+    static const Table TABLE;
+
+};
+
+#endif  // __LEDMAPPING_H
@@ -8,21 +8,43 @@
 #endif
 
 #include "assertions.h"
+#include "FrameMirror.h"
+#include "LedMapping.h"
+#include "PixelStream.h"
+#include "Prng.h"
+#include "Raster.h"
+#include "TextRenderer.h"
 
 
 LedMatrix::LedMatrix() :
+  render_state_(initialState()),
+  user_effects_(noEffects()),
+  effect_prng_(millis()),  // not from random(), the other effects' sequences would change
   leds_(LedMatrix_leds_)
 {
     this->needs_update_           = true;
-    this->hour_                   = 0;
-    this->minute_                 = 0;
-    this->second_                 = 0;
+    this->state_                  = initialState();
+    this->effects_                = NULL;
     this->current_state_          = S_SPLASH_SCREEN;
-    this->current_splash_idx_     = 0;
     this->current_transition_idx_ = 0;
-    this->seconds_mode_           = SECONDS_DOT;
-    this->update_screen_progress_ = 0;
+    this->active_count_           = 0;
     this->color_words_            = WHITE;
+    this->text_start_ms_          = 0;
+    this->frame_pending_          = false;
+    this->last_show_us_           = 0;
+    this->frames_pushed_          = 0;
+    this->frames_skipped_         = 0;
+    this->render_task_            = NULL;
+    this->stream_                 = NULL;
+    this->mirror_                 = NULL;
+    this->frame_delay_ms_         = WAIT_FOREVER;
+#if PROFILING_ENABLED
+    this->frame_due_              = false;
+    this->frame_due_us_           = 0;
+    this->tick_pending_           = false;
+    this->tick_us_                = 0;
+#endif
+    memset(this->shown_frame_, 0, sizeof(this->shown_frame_));  // setup() clears the leds
 
     // if analog input pin 0 is unconnected, random analog noise will cause the call to randomSeed() to generate
     // different seed numbers each time the sketch runs. randomSeed() will then shuffle the random function.
@@ -31,28 +53,62 @@ LedMatrix::LedMatrix() :
 
 void LedMatrix::setup()
 {
+    this->frame_.setBrightness(this->state_.brightness);  // the initial one, update() applies later changes
     this->leds_.Begin();
-    this->setBrightness(MATRIX_LED_BRIGHTNESS);
     this->leds_.ClearTo({0, 0, 0});
     this->leds_.Show();
+    initSnake();
 }
 
-void LedMatrix::update()
+uint32_t LedMatrix::update()
 {
     static uint32_t lastTrigger = millis();
 
+#if PROFILING_ENABLED
+    if (this->frame_due_ && (int32_t) (micros() - this->frame_due_us_) > (int32_t) (1000000UL / MATRIX_MAX_FPS))
+    {
+        PROFILE_MISSED_DEADLINE();
+    }
+#endif
+
+    this->frame_delay_ms_ = WAIT_FOREVER;
+
+    // take what the other tasks published since the last frame, the frame is rendered from that snapshot
+    bool fresh;
+    const RenderState& state = this->render_state_.read(&fresh);
+    if (fresh)
+    {
+        applyState(state);
+    }
+    this->effects_ = &this->user_effects_.read();
+
+    if (this->stream_ != NULL)
+    {
+        receiveStream();
+    }
+
+    if (this->frame_pending_)
+    {
+        this->show();
+    }
+
     if (this->needs_update_)
     {
         if (this->current_state_ == S_SPLASH_SCREEN)
         {
-            if ((this->*SPLASH_FUNCTIONS[this->current_splash_idx_])())
+            bool finished;
+            {
+                PROFILE_SCOPE(Profiler::STAGE_SPLASH_RANDOM + this->state_.splash_idx);
+                finished = (this->*SPLASH_FUNCTIONS[this->state_.splash_idx])();
+            }
+            if (finished)
             {
                 changeState((WiFi.status() != WL_CONNECTED) ? S_WIFI_CONNECT : S_TIME_MODE);
             }
         }
         else if (this->current_state_ == S_TIME_MODE)
         {
-            if ((this->*TRANSITION_FUNCTIONS[this->current_transition_idx_])())
+            if (transition())
             {
                 this->needs_update_ = false;
             }
@@ -61,196 +117,569 @@ void LedMatrix::update()
         {
             static uint8_t spinner = 0;
             static uint32_t lastSpin = millis();
-            this->leds_.ClearTo(BLACK);
+            this->frame_.clearTo(BLACK);
             for (uint8_t i = 0; i < 4; i++)
             {
-                this->leds_.SetPixelColor(xy(LETTERS_WIFI_XY[i][0], LETTERS_WIFI_XY[i][1]), WHITE);
+                this->frame_.setPixel(xy(LETTERS_WIFI_XY[i][0], LETTERS_WIFI_XY[i][1]), WHITE);
             }
-            this->leds_.SetPixelColor(xy(WIFI_SPINNER_XY[spinner][0], WIFI_SPINNER_XY[spinner][1]), YELLOW);
-            if (millis() - lastSpin > 100)
+            this->frame_.setPixel(xy(WIFI_SPINNER_XY[spinner][0], WIFI_SPINNER_XY[spinner][1]), YELLOW);
+            if (frameDue(&lastSpin, 100))
             {
-                lastSpin = millis();
                 spinner = (spinner + 1) % 14;
                 if (WiFi.status() == WL_CONNECTED)
                 {
                     changeState(S_WIFI_OK);
                 }
             }
-            this->leds_.Show();
+            this->show();
         }
         else if (this->current_state_ == S_WIFI_OK)
         {
-            this->leds_.ClearTo(BLACK);
+            this->frame_.clearTo(BLACK);
             for (uint8_t i = 0; i < 4; i++)
             {
-                this->leds_.SetPixelColor(xy(LETTERS_WIFI_XY[i][0], LETTERS_WIFI_XY[i][1]), GREEN);
+                this->frame_.setPixel(xy(LETTERS_WIFI_XY[i][0], LETTERS_WIFI_XY[i][1]), GREEN);
             }
-            this->leds_.Show();
+            this->show(true);
             delay(1000);
-            this->leds_.ClearTo(BLACK);
-            this->leds_.Show();
+            this->frame_.clearTo(BLACK);
+            this->show(true);
             changeState(S_TIME_MODE);
         }
         else if (this->current_state_ == S_WIFI_ERROR)
         {
             static bool toggle = true;
             static uint32_t lastBlink = millis();
-            this->leds_.ClearTo(BLACK);
+            this->frame_.clearTo(BLACK);
             for (uint8_t i = 0; i < 4; i++)
             {
-                this->leds_.SetPixelColor(xy(LETTERS_WIFI_XY[i][0], LETTERS_WIFI_XY[i][1]), toggle ? RED: WHITE);
+                this->frame_.setPixel(xy(LETTERS_WIFI_XY[i][0], LETTERS_WIFI_XY[i][1]), toggle ? RED: WHITE);
             }
             for (uint8_t i = 0; i < 2; i++)
             {
-                this->leds_.SetPixelColor(xy(LETTERS_NO_XY[i][0], LETTERS_NO_XY[i][1]), toggle ? WHITE : RED);
+                this->frame_.setPixel(xy(LETTERS_NO_XY[i][0], LETTERS_NO_XY[i][1]), toggle ? WHITE : RED);
             }
-            if (millis() - lastBlink > 1000)
+            if (frameDue(&lastBlink, 1000))
             {
-                lastBlink = millis();
                 toggle = ! toggle;
             }
-            this->leds_.Show();
+            this->show();
+        }
+        else if (this->current_state_ == S_FWUPDATE_SCREEN)
+        {
+            uint8_t  pos = this->state_.update_pos;
+            RgbColor c   = RgbColor::LinearBlend(RED, GREEN, this->state_.update_fraction);
+            for (uint8_t i = 0; i < LED_CNT; i++)
+                this->frame_.setPixel(xy(i % MATRIX_WIDTH, i / MATRIX_WIDTH), (i <= pos) ? c : BLACK);
+            this->show();
+        }
+        else if (this->current_state_ == S_TEXT)
+        {
+            const Font& font    = TextRenderer::FONT_3X5;
+            int16_t     width   = TextRenderer::textWidth(font, this->state_.text);
+            uint32_t    elapsed = millis() - this->text_start_ms_;
+            int16_t     x;
+            bool        finished;
+            if (width <= MATRIX_WIDTH)
+            {
+                x        = (MATRIX_WIDTH - width) / 2;
+                finished = elapsed > TEXT_HOLD_MS;
+            }
+            else
+            {
+                x        = MATRIX_WIDTH - (int16_t) (elapsed / TEXT_SCROLL_MS);  // enters from the right
+                finished = x < -width;
+            }
+
+            WordFrame text_frame;
+            TextRenderer::drawText(text_frame, font, this->state_.text, x, (MATRIX_HEIGHT - font.height) / 2);
+            for (uint8_t y = 0; y < MATRIX_HEIGHT; y++)
+            {
+                for (uint8_t x = 0; x < MATRIX_WIDTH; x++)
+                {
+                    this->frame_.setPixel(xy(x, y), text_frame.isSet(x, y) ? YELLOW : BLACK);
+                }
+            }
+            this->show();
+            if (finished)
+            {
+                changeState(S_TIME_MODE);
+            }
+            else if (width <= MATRIX_WIDTH)
+            {
+                requestFrame(TEXT_HOLD_MS + 1 - elapsed);
+            }
+            else
+            {
+                requestFrame(TEXT_SCROLL_MS - elapsed % TEXT_SCROLL_MS);
+            }
         }
     }
-    else
+    // also right after a transition finished: the next update() may only come with the next time, which needs an
+    // update again, so waiting for an idle call would never rotate the effects
+    if (!this->needs_update_)
     {
-        if (millis() - lastTrigger > 2000) // execute every n seconds
+        if (frameDue(&lastTrigger, 2000)) // execute every n seconds
         {
-            lastTrigger = millis();
             nextEffect();
         }
     }
+
+    if (this->frame_pending_)
+    {
+        // held back by the frame rate limit or a transfer in progress, send it as soon as it may
+        uint32_t since_show_us = micros() - this->last_show_us_;
+        uint32_t interval_us   = 1000000UL / MATRIX_MAX_FPS;
+        requestFrame((since_show_us < interval_us) ? (interval_us - since_show_us + 999) / 1000 : 0);
+    }
+#if PROFILING_ENABLED
+    this->frame_due_    = (this->frame_delay_ms_ != WAIT_FOREVER);
+    this->frame_due_us_ = micros() + this->frame_delay_ms_ * 1000;
+#endif
+    return this->frame_delay_ms_;
+}
+
+void LedMatrix::setRenderTask(TaskHandle_t task)
+{
+    this->render_task_ = task;
+}
+
+void LedMatrix::setPixelStream(PixelStream* stream)
+{
+    this->stream_ = stream;
 }
 
-void LedMatrix::setTime(const uint8_t hour, const uint8_t minute, const uint8_t second)
+void LedMatrix::setFrameMirror(FrameMirror* mirror)
+{
+    this->mirror_ = mirror;
+}
+
+void LedMatrix::setTime(const uint8_t hour, const uint8_t minute, const uint8_t second, const uint32_t second_begin_us)
 {
     uint8_t h = hour   % 12;
     uint8_t m = minute % 60;
     uint8_t s = second % 60;
-    if (h != this->hour_ || m != this->minute_ || s != this->second_)
+    bool changed = this->render_state_.update([&](RenderState& state){
+        if (h == state.hour && m == state.minute && s == state.second)
+            return false;
+        state.hour            = h;
+        state.minute          = m;
+        state.second          = s;
+        state.second_begin_us = second_begin_us;
+        return true;
+    });
+    if (changed)
     {
-        word_frame_.fromTime(h, m);
-        this->hour_         = h;
-        this->minute_       = m;
-        this->second_       = s;
-        this->millis_delta_ = millis() % 1000;
-        this->needs_update_ = true;
+        wake();
     }
 }
 
 void LedMatrix::setSecondsMode(uint8_t seconds_mode)
 {
-    if (seconds_mode != this->seconds_mode_)
+    bool changed = this->render_state_.update([&](RenderState& state){
+        if (seconds_mode == state.seconds_mode)
+            return false;
+        state.seconds_mode = seconds_mode;
+        return true;
+    });
+    if (changed)
     {
-        this->seconds_mode_ = seconds_mode;
-        this->needs_update_ = true;
+        wake();
     }
 }
 
 void LedMatrix::setSplashScreen(uint8_t splash_idx)
 {
-    this->current_splash_idx_ = splash_idx % 2;
-    changeState(S_SPLASH_SCREEN);
+    this->render_state_.update([&](RenderState& state){
+        state.splash_idx      = splash_idx % 3;
+        state.requested_state = S_SPLASH_SCREEN;
+        state.request_serial++;
+        return true;
+    });
+    wake();
+}
+
+void LedMatrix::setTransition(uint8_t transition)
+{
+    bool changed = this->render_state_.update([&](RenderState& state){
+        if (transition == state.transition || transition > sizeof(TRANSITION_FUNCTIONS) / sizeof(TRANSITION_FUNCTIONS[0]))
+            return false;
+        state.transition = transition;
+        return true;
+    });
+    if (changed)
+    {
+        wake();
+    }
+}
+
+void LedMatrix::setEffect(const EffectVm::Program& program)
+{
+    this->user_effects_.update([&](UserEffects& effects){
+        if (program.kind == EffectVm::KIND_SPLASH)
+            effects.splash = program;
+        else if (program.kind == EffectVm::KIND_TRANSITION)
+            effects.transition = program;
+        else
+            return false;
+        return true;
+    });
+    // nothing to wake up for: the splash screen is only shown on request, the transition with the next change
 }
 
 void LedMatrix::setBrightness(uint8_t value)
 {
-    this->leds_.SetBrightness(value);
-    this->needs_update_ = true;
+    bool changed = this->render_state_.update([&](RenderState& state){
+        if (value == state.brightness)
+            return false;
+        state.brightness = value;
+        return true;
+    });
+    if (changed)
+    {
+        wake();
+    }
 }
 
 void LedMatrix::setWordColor(uint8_t red, uint8_t green, uint8_t blue)
 {
-// NOT YET IMPLEMENTED
-//    this->color_words_  = RgbColor(red, green, blue);
-//    this->needs_update_ = true;
+    bool changed = this->render_state_.update([&](RenderState& state){
+        if (red == state.word_color[0] && green == state.word_color[1] && blue == state.word_color[2])
+            return false;
+        state.word_color[0] = red;
+        state.word_color[1] = green;
+        state.word_color[2] = blue;
+        return true;
+    });
+    if (changed)
+    {
+        wake();
+    }
 }
 
 void LedMatrix::showWifiConnect()
 {
-    changeState(S_WIFI_CONNECT);
+    requestState(S_WIFI_CONNECT);
 }
 void LedMatrix::showWifiOk()
 {
-    changeState(S_WIFI_OK);
+    requestState(S_WIFI_OK);
 }
 void LedMatrix::showWifiError()
 {
-    changeState(S_WIFI_ERROR);
+    requestState(S_WIFI_ERROR);
 }
 
 void LedMatrix::setUpdateProgress(unsigned int progress, unsigned int total)
 {
-    changeState(S_FWUPDATE_SCREEN);
     uint8_t pos = progress * LED_CNT / total;
-    if (pos != this->update_screen_progress_)
+    bool changed = this->render_state_.update([&](RenderState& state){
+        if (state.requested_state == S_FWUPDATE_SCREEN && pos == state.update_pos)
+            return false;
+        state.update_pos      = pos;
+        state.update_fraction = (float)progress / total;
+        state.requested_state = S_FWUPDATE_SCREEN;
+        state.request_serial++;
+        return true;
+    });
+    if (changed)
     {
-        this->update_screen_progress_ = pos;
-        RgbColor c = RgbColor::LinearBlend(RED, GREEN, (float)progress / total);
-        for (uint8_t i = 0; i < LED_CNT; i++)
-            this->leds_.SetPixelColor(xy(i % MATRIX_WIDTH, i / MATRIX_WIDTH), (i <= pos) ? c : BLACK);
-        this->leds_.Show();
+        wake();
     }
 }
 
+uint32_t LedMatrix::getFramesPushed()
+{
+    return this->frames_pushed_;
+}
+
+uint32_t LedMatrix::getFramesSkipped()
+{
+    return this->frames_skipped_;
+}
+
+void LedMatrix::showText(const char* text)
+{
+    this->render_state_.update([&](RenderState& state){
+        strncpy(state.text, text, sizeof(state.text) - 1);
+        state.text[sizeof(state.text) - 1] = '\0';
+        state.requested_state = S_TEXT;
+        state.request_serial++;  // also restarts a text that is already shown
+        return true;
+    });
+    wake();
+}
+
 // ----- private methods -----
 
 
+LedMatrix::RenderState LedMatrix::initialState()
+{
+    RenderState state;
+    memset(&state, 0, sizeof(state));
+    state.seconds_mode    = SECONDS_DOT;
+    state.brightness      = MATRIX_LED_BRIGHTNESS;
+    memset(state.word_color, 255, sizeof(state.word_color));  // white
+    state.requested_state = S_SPLASH_SCREEN;
+    return state;
+}
+
+LedMatrix::UserEffects LedMatrix::noEffects()
+{
+    UserEffects effects;
+    effects.splash     = EffectVm::none();
+    effects.transition = EffectVm::none();
+    return effects;
+}
+
+void LedMatrix::requestState(const State new_state)
+{
+    this->render_state_.update([&](RenderState& state){
+        state.requested_state = new_state;
+        state.request_serial++;
+        return true;
+    });
+    wake();
+}
+
+void LedMatrix::applyState(const RenderState& state)
+{
+    // called by the render task with a newly published state: does what the differences to the state rendered
+    // so far require
+    if (state.hour != this->state_.hour || state.minute != this->state_.minute || state.second != this->state_.second)
+    {
+        {
+            PROFILE_SCOPE(Profiler::STAGE_FROM_TIME);
+            this->word_frame_.fromTime(state.hour, state.minute);
+        }
+        this->needs_update_ = true;
+#if PROFILING_ENABLED
+        this->tick_pending_ = (this->current_state_ == S_TIME_MODE);
+        this->tick_us_      = state.second_begin_us;
+#endif
+    }
+    if (state.seconds_mode != this->state_.seconds_mode)
+    {
+        this->needs_update_ = true;
+    }
+    if (state.transition != this->state_.transition && state.transition > 0)
+    {
+        this->current_transition_idx_ = state.transition - 1;  // the running transition goes on with this one
+    }
+    if (state.brightness != this->state_.brightness)
+    {
+        this->frame_.setBrightness(state.brightness);
+        this->frame_pending_ = true;  // only the output changes, whatever the screen
+    }
+    if (memcmp(state.word_color, this->state_.word_color, sizeof(state.word_color)) != 0)
+    {
+        this->color_words_  = RgbColor(state.word_color[0], state.word_color[1], state.word_color[2]);
+        this->stale_.fill();  // the transition takes the words to the new color
+        this->needs_update_ = true;
+    }
+    if (state.request_serial != this->state_.request_serial)
+    {
+        if (state.requested_state == S_TEXT)
+        {
+            this->text_start_ms_ = millis();
+        }
+        changeState(state.requested_state);
+        this->needs_update_ = true;  // also when the state stays, e.g. for a new text
+    }
+    this->state_ = state;
+}
+
 void LedMatrix::changeState(const State new_state)
 {
     if (new_state != this->current_state_)
     {
         this->current_state_ = new_state;
+        this->stale_.fill();  // whatever the new state shows, the time has to be redrawn entirely afterwards
         this->needs_update_  = true;
+        wake();
+    }
+}
+
+void LedMatrix::wake()
+{
+    if (this->render_task_ != NULL)
+    {
+        xTaskNotifyGive(this->render_task_);
+    }
+}
+
+void LedMatrix::requestFrame(uint32_t delay_ms)
+{
+    if (delay_ms < this->frame_delay_ms_)
+    {
+        this->frame_delay_ms_ = delay_ms;
+    }
+}
+
+bool LedMatrix::frameDue(uint32_t *last_trigger, uint32_t interval_ms)
+{
+    // true once more than 'interval_ms' have passed since the last time it was; either way the next update() is
+    // requested for when it is due again
+    ASSERT(last_trigger != NULL);
+
+    uint32_t now     = millis();
+    uint32_t elapsed = now - *last_trigger;
+    if (elapsed > interval_ms)
+    {
+        *last_trigger = now;
+        requestFrame(interval_ms + 1);
+        return true;
     }
+    requestFrame(interval_ms + 1 - elapsed);
+    return false;
 }
 
 void LedMatrix::nextEffect()
 {
+    if (this->state_.transition > 0)
+    {
+        return;  // only the one set
+    }
+    // the uploaded transition only while there is one
     uint8_t n = sizeof(TRANSITION_FUNCTIONS) / sizeof(TRANSITION_FUNCTIONS[0]);
-    this->current_transition_idx_ = (this->current_transition_idx_ + 1) % n;
+    do
+    {
+        this->current_transition_idx_ = (this->current_transition_idx_ + 1) % n;
+    } while (this->current_transition_idx_ == TRANSITION_USER && this->effects_->transition.duration_ms == 0);
+}
+
+void LedMatrix::receiveStream()
+{
+    // everything that arrived since the last frame; the pixels go straight into the led buffer, so when several
+    // frames are waiting only the latest one is shown
+    PixelStream::Packet packet;
+    bool push = false;
+    while (this->stream_->next(&packet))
+    {
+        if (this->current_state_ == S_FWUPDATE_SCREEN)
+        {
+            continue;  // the progress bar must stay visible
+        }
+        if (this->current_state_ != S_STREAM)
+        {
+            changeState(S_STREAM);
+            this->frame_.clearTo(BLACK);  // the pixels the controller does not send
+        }
+        this->stream_->readPixels(packet, this->frame_);
+        push |= packet.push;
+    }
+
+    if (push)
+    {
+        this->show();
+    }
+    if (this->current_state_ == S_STREAM && !this->stream_->isActive())
+    {
+        changeState(S_TIME_MODE);  // the controller stopped sending
+    }
+    requestFrame((this->current_state_ == S_STREAM) ? PixelStream::POLL_MS : PixelStream::IDLE_POLL_MS);
 }
 
 void LedMatrix::disableLEDs()
 {
-    this->leds_.ClearTo(BLACK);
-    this->leds_.Show();
+    this->frame_.clearTo(BLACK);
+    this->show(true);
+}
+
+void LedMatrix::output()
+{
+    // the output stage, once per frame that changed: the frame buffer through brightness and gamma into the bus.
+    // The controller's pixels come gamma corrected already.
+    if (this->frame_.isChanged())
+    {
+        PROFILE_SCOPE(Profiler::STAGE_OUTPUT);
+        this->frame_.setGamma(this->current_state_ != S_STREAM);
+        this->frame_.output(this->leds_);
+    }
+}
+
+void LedMatrix::show(bool immediately)
+{
+    // Sending 143 leds takes about 4.3 ms, so only send frames that really differ from what the leds show.
+    // A changed frame that comes too early for MATRIX_MAX_FPS, or while the previous one is still being sent in
+    // the background, is held back; it (or a newer one) is sent by a later call, at the latest by the next
+    // update(). 'immediately' ignores the limit, for frames that must be visible right now (e.g. before a delay).
+    output();
+    if (!this->leds_.IsDirty() || memcmp(this->leds_.Pixels(), this->shown_frame_, sizeof(this->shown_frame_)) == 0)
+    {
+        this->leds_.ResetDirty();
+        this->frame_pending_ = false;
+        this->frames_skipped_++;
+        profileTick();  // unchanged, so the leds show the new second already
+        return;
+    }
+
+    uint32_t now = micros();
+    if (!immediately && (now - this->last_show_us_ < 1000000UL / MATRIX_MAX_FPS || !this->leds_.CanShow()))
+    {
+        this->frame_pending_ = true;
+        return;
+    }
+
+    {
+        PROFILE_SCOPE(Profiler::STAGE_SHOW);
+        this->leds_.Show();
+    }
+    profileTick();
+    memcpy(this->shown_frame_, this->leds_.Pixels(), sizeof(this->shown_frame_));
+    this->last_show_us_  = now;
+    this->frame_pending_ = false;
+    this->frames_pushed_++;
+    if (this->mirror_ != NULL)
+    {
+        this->mirror_->offer(this->shown_frame_);
+    }
+}
+
+void LedMatrix::profileTick()
+{
+#if PROFILING_ENABLED
+    if (this->tick_pending_)
+    {
+        PROFILE_RECORD(Profiler::STAGE_TICK_TO_FRAME, micros() - this->tick_us_);
+        this->tick_pending_ = false;
+    }
+#endif
 }
 
 uint16_t LedMatrix::xy(const uint8_t x, const uint8_t y)
 {
-    uint8_t new_x;
-    if (y & 0x01)
-        new_x = (MATRIX_WIDTH - 1) - x;  // odd rows run backwards
-    else
-        new_x = x;
-    return (y * MATRIX_WIDTH) + new_x;
+    return LedMapping::index(x, y);
 }
 
 bool LedMatrix::splashRandom()
 {
-    static uint32_t lastTrigger = millis();
+    // reveals the leds in the order of a random permutation, one per 20 ms: constant cost per step and always
+    // LED_CNT steps in total
+    static AnimationClock clock;
+    static uint16_t order[LED_CNT];
+    static uint16_t revealed = LED_CNT;
 
-    bool finished = false;
-    if (millis() - lastTrigger > 20) // execute every n milliseconds
+    if (revealed == LED_CNT)
     {
-        lastTrigger = millis();
-        uint8_t x          = random(MATRIX_WIDTH);
-        uint8_t y          = random(MATRIX_HEIGHT);
-        uint8_t index      = xy(x, y);
-        bool    all_active = false;
-
-        uint8_t i = index;
-        while (!all_active && this->leds_.GetPixelColor(i).CalculateBrightness() > 0)
-        {
-            i          = (i + 1) % LED_CNT;
-            all_active = (i == index);
-        }
+        for (uint16_t i = 0; i < LED_CNT; i++)
+            order[i] = i;
+        Prng prng(random(0x7FFFFFFF));
+        prng.shuffle(order, LED_CNT);
+        revealed = 0;
+        clock.start();
+    }
 
-        this->leds_.SetPixelColor(i, this->color_words_);
-        this->leds_.Show();
-        finished = all_active;
+    for (uint32_t steps = clock.takeSteps(20); steps > 0 && revealed < LED_CNT; steps--)
+    {
+        this->frame_.setPixel(order[revealed], this->color_words_);
+        revealed++;
     }
+    this->show();
+
+    bool finished = (revealed == LED_CNT);  // starts over with a new permutation next time
+    if (!finished)
+        requestFrame(clock.untilNextStep(20));
     return finished;
 }
 
@@ -274,203 +703,419 @@ const void LedMatrix::snakeStep(uint8_t *x, uint8_t *y)
     }
 }
 
+void LedMatrix::initSnake()
+{
+    // the snake splashes only walk along this table, so snakeStep() runs once per pixel at startup instead of
+    // up to LED_CNT times per frame
+    uint8_t x = 0;
+    uint8_t y = 0;
+    this->snake_length_ = 0;
+    do
+    {
+        this->snake_path_[this->snake_length_++] = xy(x, y);
+        snakeStep(&x, &y);
+    } while ((x != 0 || y != 0) && this->snake_length_ < LED_CNT);
+
+    for (uint8_t i = 0; i < 128; i++)
+        this->snake_colors_[i] = HsbColor(i / 128.0f, 1.0f, 1.0f);
+}
+
 bool LedMatrix::splashSnake()
 {
-    static uint32_t lastTrigger = millis();
+    // the head moves one pixel along the snake path per 30 ms
+    static AnimationClock clock;
+    static uint8_t  hue  = 0;
+    static uint16_t head = 0;  // position on the snake path
+
+    if (head == 0)
+        clock.start();
 
     bool finished = false;
-    if (millis() - lastTrigger > 30) // execute every n milliseconds
+    for (uint32_t steps = clock.takeSteps(30); steps > 0 && !finished; steps--)
     {
-        lastTrigger = millis();
-        static uint8_t hue = 0;
-        static uint8_t x = 0;
-        static uint8_t y = 0;
-
-        // fade everything out a bit
-        for (uint8_t i = 0; i < LED_CNT; i++)
-            if (this->leds_.GetPixelColor(i).CalculateBrightness() > 180)
+        // fade out what was shown before a bit. Every step darkens it by 20 per channel, so after 4 steps nothing
+        // is brighter than 180 anymore (the fully saturated snake colors never are).
+        if (head < 4)
+            for (uint16_t i = 0; i < LED_CNT; i++)
             {
-                RgbColor c = this->leds_.GetPixelColor(i);
-                c.Darken(20);
-                this->leds_.SetPixelColor(i, c);
+                RgbColor c = FrameBuffer::toRgb(this->frame_.getPixel(i));
+                if (c.CalculateBrightness() > 180)
+                {
+                    c.Darken(20);
+                    this->frame_.setPixel(i, c);
+                }
             }
 
-        // and reactivate current pixel
-        this->leds_.SetPixelColor(xy(x, y), HsbColor(hue, 255, 255));
-
-        this->leds_.Show();
+        // and activate current pixel
+        this->frame_.setPixel(this->snake_path_[head], this->snake_colors_[hue / 2]);
         hue += 2;
 
         // move it
-        snakeStep(&x, &y);
+        head = (head + 1) % this->snake_length_;
 
-        finished = (x == 0 && y == 0);
+        finished = (head == 0);
     }
+    this->show();
+
+    if (!finished)
+        requestFrame(clock.untilNextStep(30));
     return finished;
 }
 
 bool LedMatrix::splashSnake2()
 {
-    static uint32_t lastTrigger = millis();
+    // the head moves one pixel along the snake path per 30 ms, the colors flow from the tail to the head, so the
+    // whole body changes every step
+    static AnimationClock clock;
+    static uint16_t goal = 0;  // position of the head on the snake path
 
-    bool finished = false;
-    if (millis() - lastTrigger > 30) // execute every n milliseconds
-    {
-        lastTrigger = millis();
-        static uint8_t goal_hue = 0;
-        static uint8_t goal_x = 0;
-        static uint8_t goal_y = 0;
-
-        snakeStep(&goal_x, &goal_y);
-        goal_hue += 2;
+    if (goal == 0)
+        clock.start();
 
-        uint8_t hue = goal_hue;
-        uint8_t x = 0;
-        uint8_t y = 0;
-        while (x != goal_x || y != goal_y)
-        {
-            this->leds_.SetPixelColor(xy(x, y), HsbColor(hue, 255, 255));
-            hue -= 2;
-            snakeStep(&x, &y);
-        }
-        this->leds_.Show();
+    uint32_t steps = clock.takeSteps(30);
+    goal = (goal + steps < this->snake_length_) ? goal + steps : this->snake_length_;
 
-        finished = (goal_x == 0 && goal_y == 0);
+    uint8_t hue = 2 * goal;
+    for (uint16_t i = 0; i < goal && i < this->snake_length_ - 1; i++)
+    {
+        this->frame_.setPixel(this->snake_path_[i], this->snake_colors_[hue / 2]);
+        hue -= 2;
     }
+    this->show();
+
+    bool finished = (goal == this->snake_length_);
+    if (finished)
+        goal = 0;
+    else
+        requestFrame(clock.untilNextStep(30));
     return finished;
 }
 
-bool LedMatrix::transFade()
+bool LedMatrix::splashUser()
 {
-    static uint32_t lastTrigger = millis();
+    // the uploaded splash screen, over all pixels for its duration; over at once while there is none
+    static AnimationClock clock;
+    static bool running = false;
 
-    bool finished = false;
-    if (millis() - lastTrigger > 0) // execute every n milliseconds
+    const EffectVm::Program& program = this->effects_->splash;
+    if (program.duration_ms == 0)
+    {
+        running = false;
+        return true;
+    }
+    if (!running)
+    {
+        for (uint16_t i = 0; i < LED_CNT; i++)
+            this->fade_from_[i] = this->frame_.getPixel(i);
+        clock.start(program.duration_ms);
+        running = true;
+    }
+
+    uint32_t elapsed = clock.elapsed();
+    if (clock.takeSteps(SPLASH_USER_INTERVAL_MS) == 0 && elapsed < program.duration_ms)
+    {
+        requestFrame(clock.untilNextStep(SPLASH_USER_INTERVAL_MS));
+        return false;  // an early call (e.g. to send a frame that was held back), no new frame due yet
+    }
+    int32_t  vars[EffectVm::VAR_COUNT];
+    vars[EffectVm::VAR_T]        = EffectVm::fromMillis(elapsed);
+    vars[EffectVm::VAR_PROGRESS] = EffectVm::fraction(elapsed, program.duration_ms);
+    vars[EffectVm::VAR_PHASE]    = EffectVm::fraction(secondPhaseUs(), 1000000);
+    for (uint8_t y = 0; y < MATRIX_HEIGHT; y++)
     {
-        lastTrigger = millis();
-        finished = true;
         for (uint8_t x = 0; x < MATRIX_WIDTH; x++)
         {
-            for (uint8_t y = 0; y < MATRIX_HEIGHT; y++)
-            {
-                RgbColor p = this->leds_.GetPixelColor(xy(x, y));
-                if (this->word_frame_.isSet(x, y))
-                {
-                    p.Lighten(50);
-                    this->leds_.SetPixelColor(xy(x, y), p);
-                    finished &= p.CalculateBrightness() >= 255;
-                }
-                else
-                {
-                    p.Darken(10);
-                    this->leds_.SetPixelColor(xy(x, y), p);
-                    finished &= p.CalculateBrightness() <= 0;
-                }
-            }
+            runEffect(program, vars, x, y);
         }
-        if (this->seconds_mode_ == SECONDS_HAND || this->seconds_mode_ == SECONDS_DOT)
+    }
+    this->show();
+
+    bool finished = (elapsed >= program.duration_ms);  // the last frame was the one at the end of the duration
+    if (finished)
+        running = false;
+    else
+        requestFrame(clock.untilNextStep(SPLASH_USER_INTERVAL_MS));
+    return finished;
+}
+
+bool LedMatrix::transition()
+{
+    // Unchanged pixels are never touched: the words that appear or disappear and the pixels something else painted
+    // over are collected into active_ once, the transition's steps work them off, and it is finished as soon as
+    // there are no active pixels left (and no second hand needs to move).
+    const Transition& t = TRANSITION_FUNCTIONS[this->current_transition_idx_];
+
+    if (this->active_count_ == 0)
+    {
+        this->transition_clock_.start();
+    }
+    addActive((this->word_frame_ ^ this->shown_words_) | this->stale_);
+    this->shown_words_ = this->word_frame_;
+    this->stale_.clear();
+
+    uint32_t steps = this->transition_clock_.takeSteps(t.interval_ms);
+    if (steps == 0)
+    {
+        requestFrame(this->transition_clock_.untilNextStep(t.interval_ms));
+        return false;
+    }
+
+    {
+        PROFILE_SCOPE(Profiler::STAGE_TRANS_FADE + this->current_transition_idx_);
+        (this->*t.step)(steps, t.max_pixels);
+    }
+
+    bool moving_hand = (this->state_.seconds_mode == SECONDS_HAND || this->state_.seconds_mode == SECONDS_DOT);
+    {
+        PROFILE_SCOPE(Profiler::STAGE_COMPOSE);
+        this->overlay_.clear();
+        if (moving_hand)
         {
             drawSecondHand();
         }
-        else if (this->seconds_mode_ == SECONDS_DECIMAL || this->seconds_mode_ == SECONDS_COUNTDOWN)
+        else if (this->state_.seconds_mode == SECONDS_DECIMAL || this->state_.seconds_mode == SECONDS_COUNTDOWN)
         {
             drawSecondDigits();
         }
-        this->leds_.Show();
+    }
+    this->show();
+
+    bool finished = (this->active_count_ == 0) && !moving_hand;
+    if (!finished)
+    {
+        requestFrame(this->transition_clock_.untilNextStep(t.interval_ms));
     }
     return finished;
 }
 
-bool LedMatrix::transSetHard()
+void LedMatrix::addActive(const MatrixFrame& pixels)
+{
+    // (re)starts the pixels from the color they have now
+    uint16_t now = millis();
+    pixels.forEachSet([&](uint8_t x, uint8_t y){
+        uint16_t i = xy(x, y);
+        this->fade_from_[i]  = this->frame_.getPixel(i);
+        this->fade_start_[i] = now;
+        activate(x, y);
+    });
+}
+
+void LedMatrix::activate(uint8_t x, uint8_t y)
 {
-    for (uint8_t x = 0; x < MATRIX_WIDTH; x++)
+    if (!this->active_.isSet(x, y))
     {
-        for (uint8_t y = 0; y < MATRIX_HEIGHT; y++)
-        {
-            this->leds_.SetPixelColor(xy(x, y), this->word_frame_.isSet(x, y) ? this->color_words_ : BLACK);
-        }
+        uint16_t pixel = y * MATRIX_WIDTH + x;
+        this->active_.set(x, y);
+        this->active_pos_[pixel] = this->active_count_;
+        this->active_list_[this->active_count_++] = pixel;
     }
-    if (this->seconds_mode_ == SECONDS_HAND || this->seconds_mode_ == SECONDS_DOT)
+}
+
+void LedMatrix::deactivate(uint8_t x, uint8_t y)
+{
+    // the last one of the list takes the place of the pixel
+    if (this->active_.isSet(x, y))
     {
-        drawSecondHand();
+        uint16_t pixel = y * MATRIX_WIDTH + x;
+        uint16_t last  = this->active_list_[--this->active_count_];
+        this->active_.reset(x, y);
+        this->active_list_[this->active_pos_[pixel]] = last;
+        this->active_pos_[last] = this->active_pos_[pixel];
     }
-    else if (this->seconds_mode_ == SECONDS_DECIMAL || this->seconds_mode_ == SECONDS_COUNTDOWN)
+}
+
+void LedMatrix::settle(uint8_t x, uint8_t y)
+{
+    // sets a pixel to its final color
+    this->frame_.setPixel(xy(x, y), this->word_frame_.isSet(x, y) ? this->color_words_ : BLACK);
+    deactivate(x, y);
+}
+
+void LedMatrix::settleOverlay()
+{
+    // the transitions that set pixels hard repair what the seconds drew during the last step right away, that is
+    // not part of their max_pixels
+    this->overlay_.forEachSet([&](uint8_t x, uint8_t y){ settle(x, y); });
+}
+
+void LedMatrix::transFade(uint32_t steps, uint16_t max_pixels)
+{
+    // Blends every active pixel from the color it had when it became active to its final one. The duration is
+    // proportional to the distance, so a pixel fades as fast as it always did, however many frames there are.
+    // What the seconds drew during the last step fades out the same way.
+    addActive(this->overlay_);
+    uint16_t now = millis();
+    this->active_.forEachSet([&](uint8_t x, uint8_t y){
+        if (max_pixels == 0)
+            return;
+        max_pixels--;
+
+        uint16_t i = xy(x, y);
+        bool     lit = this->word_frame_.isSet(x, y);
+        FrameBuffer::Color from = this->fade_from_[i];
+        FrameBuffer::Color to   = FrameBuffer::fromRgb(lit ? this->color_words_ : BLACK);
+
+        uint16_t distance = 0;
+        for (int32_t d : { to.R - from.R, to.G - from.G, to.B - from.B })
+            if (abs(d) > distance)
+                distance = abs(d);
+        uint32_t duration_ms = (uint32_t) distance * (lit ? FADE_IN_MS : FADE_OUT_MS) / 65535;
+        uint16_t t = Easing::inOutCubic(AnimationClock::progress((uint16_t) (now - this->fade_start_[i]), duration_ms));
+
+        FrameBuffer::Color color = { Easing::lerp16(from.R, to.R, t),
+                                     Easing::lerp16(from.G, to.G, t),
+                                     Easing::lerp16(from.B, to.B, t) };
+        this->frame_.setPixel(i, color);
+        if (t == AnimationClock::ONE)
+        {
+            deactivate(x, y);
+        }
+    });
+}
+
+void LedMatrix::transWipe(uint32_t steps, uint16_t max_pixels)
+{
+    // settles the changed pixels column by column from left to right, columns without changes are skipped
+    settleOverlay();
+    for (; steps > 0 && this->active_count_ > 0; steps--)
     {
-        drawSecondDigits();
+        uint8_t column = MATRIX_WIDTH;
+        this->active_.forEachSet([&](uint8_t x, uint8_t y){
+            if (x < column)
+                column = x;
+        });
+        uint16_t budget = max_pixels;
+        this->active_.forEachSet([&](uint8_t x, uint8_t y){
+            if (x == column && budget > 0)
+            {
+                budget--;
+                settle(x, y);
+            }
+        });
     }
-    this->leds_.Show();
-    return true;
 }
 
-void LedMatrix::drawSecondHand()
+void LedMatrix::transTypewriter(uint32_t steps, uint16_t max_pixels)
 {
-    // helper functions
-    auto swap = [](int* a, int* b){ int temp = *a; *a = *b; *b = temp; };
-    auto draw = [&](int x, int y, double val){
-        if ((x >= 0) && (x < MATRIX_WIDTH) && (y >= 0) && (y < MATRIX_HEIGHT) &&
-            (this->seconds_mode_ == SECONDS_HAND || x == 0 || x == MATRIX_WIDTH-1 || y == 0 || y == MATRIX_HEIGHT-1))
+    // settles the changed pixels one after the other in reading order
+    settleOverlay();
+    uint32_t budget = steps * max_pixels;
+    this->active_.forEachSet([&](uint8_t x, uint8_t y){
+        if (budget > 0)
         {
-            uint8_t v1 = 100 * val;
-            uint8_t v2 = 250 * val;
-            if (this->word_frame_.isSet(x, y))
-                this->leds_.SetPixelColor(xy(x, y), RgbColor(255, 255-v2, 255-v2));
-            else
-                this->leds_.SetPixelColor(xy(x, y), RgbColor(v1, 0, 0));
+            budget--;
+            settle(x, y);
         }
-    };
+    });
+}
 
-    const int HAND_LENGTH = 1500;
+void LedMatrix::transDissolve(uint32_t steps, uint16_t max_pixels)
+{
+    // settles randomly chosen changed pixels, each pick straight from the list of the active ones
+    static Prng prng(random(0x7FFFFFFF));
 
-    uint16_t ms = (millis() - millis_delta_) % 1000;
-    double a = (second_ + ms/1000.0) * 2 * 3.1415 / 60;  // angle of the second hand
+    settleOverlay();
+    for (uint32_t budget = steps * max_pixels; budget > 0 && this->active_count_ > 0; budget--)
+    {
+        uint16_t pixel = this->active_list_[prng.below(this->active_count_)];
+        settle(pixel % MATRIX_WIDTH, pixel / MATRIX_WIDTH);
+    }
+}
 
-    int x0 = MATRIX_WIDTH  / 2;
-    int y0 = MATRIX_HEIGHT / 2;
-    int x1 = x0 + HAND_LENGTH * sin(a);
-    int y1 = y0 - HAND_LENGTH * cos(a);
+void LedMatrix::transUser(uint32_t steps, uint16_t max_pixels)
+{
+    // the uploaded transition: every active pixel runs the program for the duration since it became active, then
+    // it is settled, like in transFade() (which stands in while there is no program)
+    const EffectVm::Program& program = this->effects_->transition;
+    if (program.duration_ms == 0)
+    {
+        transFade(steps, max_pixels);
+        return;
+    }
 
-    // --- Xiaolin Wu's line algorithm ---
+    addActive(this->overlay_);
+    uint16_t now = millis();
+    int32_t  vars[EffectVm::VAR_COUNT];
+    vars[EffectVm::VAR_PHASE] = EffectVm::fraction(secondPhaseUs(), 1000000);
+    this->active_.forEachSet([&](uint8_t x, uint8_t y){
+        uint16_t elapsed = now - this->fade_start_[xy(x, y)];
+        if (elapsed >= program.duration_ms)
+        {
+            settle(x, y);
+            return;
+        }
+        vars[EffectVm::VAR_T]        = EffectVm::fromMillis(elapsed);
+        vars[EffectVm::VAR_PROGRESS] = EffectVm::fraction(elapsed, program.duration_ms);
+        runEffect(program, vars, x, y);
+    });
+}
 
-    int steep = abs(y1 - y0) > abs(x1 - x0);
+void LedMatrix::transSetHard(uint32_t steps, uint16_t max_pixels)
+{
+    // settles all changed pixels at once
+    settleOverlay();
+    this->active_.forEachSet([&](uint8_t x, uint8_t y){ settle(x, y); });
+}
 
-    // swap the co-ordinates if slope > 1 or we draw backwards 
-    if (steep)
-    {
-        swap(&x0, &y0);
-        swap(&x1, &y1);
-    }
-    if (x0 > x1)
+void LedMatrix::runEffect(const EffectVm::Program& program, int32_t* vars, uint8_t x, uint8_t y)
+{
+    // the variables of the pixel besides the times and the phase, which the caller set
+    uint16_t i   = xy(x, y);
+    bool     lit = this->word_frame_.isSet(x, y);
+    FrameBuffer::Color from = this->fade_from_[i];
+    FrameBuffer::Color to   = FrameBuffer::fromRgb(lit ? this->color_words_ : BLACK);
+    FrameBuffer::Color now  = this->frame_.getPixel(i);
+    vars[EffectVm::VAR_X]      = x * EffectVm::ONE;
+    vars[EffectVm::VAR_Y]      = y * EffectVm::ONE;
+    vars[EffectVm::VAR_LIT]    = lit ? EffectVm::ONE : 0;
+    vars[EffectVm::VAR_RAND]   = this->effect_prng_.next() >> 16;
+    vars[EffectVm::VAR_FROM_R] = EffectVm::fromChannel(from.R);
+    vars[EffectVm::VAR_FROM_G] = EffectVm::fromChannel(from.G);
+    vars[EffectVm::VAR_FROM_B] = EffectVm::fromChannel(from.B);
+    vars[EffectVm::VAR_TO_R]   = EffectVm::fromChannel(to.R);
+    vars[EffectVm::VAR_TO_G]   = EffectVm::fromChannel(to.G);
+    vars[EffectVm::VAR_TO_B]   = EffectVm::fromChannel(to.B);
+    vars[EffectVm::VAR_R]      = EffectVm::fromChannel(now.R);
+    vars[EffectVm::VAR_G]      = EffectVm::fromChannel(now.G);
+    vars[EffectVm::VAR_B]      = EffectVm::fromChannel(now.B);
+
+    EffectVm::run(program, vars);
+
+    FrameBuffer::Color color = { EffectVm::toChannel(vars[EffectVm::VAR_R]), EffectVm::toChannel(vars[EffectVm::VAR_G]),
+                                 EffectVm::toChannel(vars[EffectVm::VAR_B]) };
+    if (!FrameBuffer::equal(color, now))
     {
-        swap(&x0, &x1);
-        swap(&y0, &y1);
+        this->frame_.setPixel(i, color);
     }
+}
 
-    // compute the slope
-    int dx = x1 - x0;
-    int dy = y1 - y0;
-    double gradient = (double)dy / dx;
-    if (dx == 0.0)
-        gradient = 1.0;
+uint32_t LedMatrix::secondPhaseUs()
+{
+    // time since the shown second began, from the micros() it began at; held at its end while the next second is
+    // late, rather than starting over
+    uint32_t phase = micros() - this->state_.second_begin_us;
+    return (phase < 1000000) ? phase : 999999;
+}
+
+void LedMatrix::drawSecondHand()
+{
+    auto draw = [&](int8_t x, int8_t y, uint16_t coverage){
+        this->overlay_.set(x, y);
+        uint8_t v1 = (100 * coverage) / Raster::COVERAGE_FULL;
+        uint8_t v2 = (250 * coverage) / Raster::COVERAGE_FULL;
+        if (this->word_frame_.isSet(x, y))
+            this->frame_.setPixel(xy(x, y), RgbColor(255, 255-v2, 255-v2));
+        else
+            this->frame_.setPixel(xy(x, y), RgbColor(v1, 0, 0));
+    };
 
-    int xpxl1 = x0;
-    int xpxl2 = x1;
-    double intery = y0 + gradient; // first y-intersection for the main loop
+    uint16_t ms    = secondPhaseUs() / 1000;
+    uint16_t angle = Raster::angle(this->state_.second * 1000 + ms, 60000);  // angle of the second hand
 
-    // main loop
-    if (steep)
-        for (int x = xpxl1 + 1; x <= xpxl2 - 1; x++)
-        {
-            draw(floor(intery),   x, floor(intery) - intery + 1);
-            draw(floor(intery)+1, x, intery - floor(intery));
-            intery += gradient;
-        }
+    if (this->state_.seconds_mode == SECONDS_HAND)
+        Raster::ray(MATRIX_WIDTH / 2, MATRIX_HEIGHT / 2, angle, draw);
     else
-        for (int x = xpxl1 + 1; x <= xpxl2 - 1; x++)
-        {
-            draw(x, floor(intery),   floor(intery) - intery + 1);
-            draw(x, floor(intery)+1, intery - floor(intery));
-            intery += gradient;
-        }
+        Raster::ringDot(MATRIX_WIDTH / 2, MATRIX_HEIGHT / 2, angle, draw);
 }
 
 void LedMatrix::drawSecondDigits()
@@ -480,138 +1125,38 @@ void LedMatrix::drawSecondDigits()
         uint8_t blue_v2 = 150;
         uint8_t red_v1  = 0;
         uint8_t red_v2  = 0;
-        if (this->seconds_mode_ == SECONDS_COUNTDOWN)
+        if (this->state_.seconds_mode == SECONDS_COUNTDOWN)
         {
             blue_v1 = 0;
             blue_v2 = 0;
             red_v1  = 200;
             red_v2  = 250;
         }
+        this->overlay_.set(x, y);
         if (this->word_frame_.isSet(x, y))
-            this->leds_.SetPixelColor(xy(x, y), RgbColor(255-blue_v2, 255-blue_v2-red_v2, 255-red_v2));
+            this->frame_.setPixel(xy(x, y), RgbColor(255-blue_v2, 255-blue_v2-red_v2, 255-red_v2));
         else
-            this->leds_.SetPixelColor(xy(x, y), RgbColor(red_v1, 0, blue_v1));
+            this->frame_.setPixel(xy(x, y), RgbColor(red_v1, 0, blue_v1));
     };
 
-    const bool bits[10][45] = { { 0, 1, 1, 1, 0,   // 0
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  0, 1, 1, 1, 0 },
-                                { 0, 0, 1, 1, 0,   // 1
-                                  0, 1, 0, 1, 0,
-                                  1, 0, 0, 1, 0,
-                                  0, 0, 0, 1, 0,
-                                  0, 0, 0, 1, 0,
-                                  0, 0, 0, 1, 0,
-                                  0, 0, 0, 1, 0,
-                                  0, 0, 0, 1, 0,
-                                  0, 0, 0, 1, 0 },
-                                { 0, 1, 1, 1, 0,   // 2
-                                  1, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1,
-                                  0, 1, 1, 1, 0,
-                                  1, 0, 0, 0, 0,
-                                  1, 0, 0, 0, 0,
-                                  1, 0, 0, 0, 0,
-                                  1, 1, 1, 1, 1 },
-                                { 1, 1, 1, 1, 0,   // 3
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1,
-                                  0, 1, 1, 1, 0,
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1,
-                                  1, 1, 1, 1, 0 },
-                                { 1, 0, 0, 0, 1,   // 4
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  0, 1, 1, 1, 1,
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1 },
-                                { 1, 1, 1, 1, 1,   // 5
-                                  1, 0, 0, 0, 0,
-                                  1, 0, 0, 0, 0,
-                                  1, 0, 0, 0, 0,
-                                  0, 1, 1, 1, 0,
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  0, 1, 1, 1, 0 },
-                                { 0, 1, 1, 1, 0,   // 6
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 0,
-                                  1, 0, 0, 0, 0,
-                                  1, 1, 1, 1, 0,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  0, 1, 1, 1, 0 },
-                                { 1, 1, 1, 1, 1,   // 7
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 1, 0,
-                                  0, 0, 0, 1, 0,
-                                  0, 0, 1, 0, 0,
-                                  0, 0, 1, 0, 0,
-                                  0, 1, 0, 0, 0,
-                                  0, 1, 0, 0, 0 },
-                                { 0, 1, 1, 1, 0,   // 8
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  0, 1, 1, 1, 0,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  0, 1, 1, 1, 0 },
-                                { 0, 1, 1, 1, 0,   // 9
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  0, 1, 1, 1, 1,
-                                  0, 0, 0, 0, 1,
-                                  0, 0, 0, 0, 1,
-                                  1, 0, 0, 0, 1,
-                                  0, 1, 1, 1, 0 },
-                              };
-    uint8_t sec = second_;
-    if (this->seconds_mode_ == SECONDS_COUNTDOWN)
-    {
-        sec = 59 - second_;
-        if (second_ < 9)  // hold "00" for 10 seconds
+    uint8_t sec = this->state_.second;
+    if (this->state_.seconds_mode == SECONDS_COUNTDOWN)
+    {
+        sec = 59 - this->state_.second;
+        if (this->state_.second < 9)  // hold "00" for 10 seconds
             sec = 0;
     }
-    uint8_t sec1  = sec % 10;
-    uint8_t sec10 = sec / 10;
 
-    uint8_t sec1_offset_x = 3;
-
-    if ((this->seconds_mode_ != SECONDS_COUNTDOWN) || (sec10 > 0))
+    char digits[3] = { (char) ('0' + sec / 10), (char) ('0' + sec % 10), '\0' };
+    int16_t x = 1;
+    if ((this->state_.seconds_mode == SECONDS_COUNTDOWN) && (sec < 10))
     {
-        for (int i = 0; i < 45; i++)
-        {
-            uint8_t x = 1 + i % 5;
-            uint8_t y = 1 + i / 5;
-            if (bits[sec10][i])
-                draw(x, y);
-        }
-        sec1_offset_x = 6;
-    }
-    for (int i = 0; i < 45; i++)
-    {
-        uint8_t x = 1 + sec1_offset_x + i % 5;
-        uint8_t y = 1 + i / 5;
-        if (bits[sec1][i])
-            draw(x, y);
+        digits[0] = digits[1];  // single digit, centered
+        digits[1] = '\0';
+        x = 4;
     }
+
+    WordFrame digits_frame;
+    TextRenderer::drawText(digits_frame, TextRenderer::FONT_DIGITS_5X9, digits, x, 1);
+    digits_frame.forEachSet(draw);
 }
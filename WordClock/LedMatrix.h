@@ -2,14 +2,42 @@
 #define __LEDMATRIX_H
 
 #include <Arduino.h>
-#include <NeoPixelBrightnessBus.h>  // "NeoPixelBus" by Makuna (v2.4.1)
+#include <NeoPixelBus.h>  // "NeoPixelBus" by Makuna (v2.4.1)
 
 #include "configuration.h"
+#include "AnimationClock.h"
+#include "EffectVm.h"
+#include "FrameBuffer.h"
+#include "Prng.h"
+#include "Profiler.h"
+#include "TripleBuffer.h"
 #include "WordFrame.h"
 
 const uint16_t LED_CNT = MATRIX_WIDTH * MATRIX_HEIGHT;
 
-typedef NeoPixelBrightnessBus<NeoGrbFeature, Neo800KbpsMethod> NeoPixelBusType;
+class FrameMirror;
+class PixelStream;
+
+// how the frames get to the leds (MATRIX_LED_OUTPUT). Bit-banging blocks the led task for the whole transfer
+// (about 4.3 ms) with interrupts off. The RMT and I2S methods send from a buffer of their own in the background:
+// Show() only waits if the previous frame is still on the wire, and the next frame renders meanwhile.
+#define LED_OUTPUT_BITBANG  0
+#define LED_OUTPUT_RMT      1  // RMT channel 0
+#define LED_OUTPUT_I2S      2  // I2S bus 1 with DMA
+
+#if !defined(ESP32)
+    typedef Neo800KbpsMethod LedOutputMethod;
+#elif MATRIX_LED_OUTPUT == LED_OUTPUT_BITBANG
+    typedef NeoEsp32BitBang800KbpsMethod LedOutputMethod;
+#elif MATRIX_LED_OUTPUT == LED_OUTPUT_RMT
+    typedef NeoEsp32Rmt0800KbpsMethod LedOutputMethod;
+#elif MATRIX_LED_OUTPUT == LED_OUTPUT_I2S
+    typedef NeoEsp32I2s1800KbpsMethod LedOutputMethod;
+#else
+    #error unknown MATRIX_LED_OUTPUT
+#endif
+
+typedef NeoPixelBus<NeoGrbFeature, LedOutputMethod> NeoPixelBusType;  // the brightness is FrameBuffer's
 static NeoPixelBusType LedMatrix_leds_(LED_CNT, MATRIX_LED_PIN);
 
 class LedMatrix
@@ -25,25 +53,60 @@ public:
         SECONDS_COUNTDOWN = 4   // like SECONDS_DECIMAL but as countdown
     } SecondMode;
 
+    static const uint32_t WAIT_FOREVER = 0xFFFFFFFF;  // see update()
+
     LedMatrix();
 
     void setup();
 
-    void update();
+    // renders the next frame if one is due and returns the time [ms] until the next one is, or WAIT_FOREVER.
+    // Every change that needs rendering (setTime(), the setters, ...) notifies the render task, so it can sleep
+    // on ulTaskNotifyTake() in between instead of polling.
+    // The setters may be called from any task: they only publish a new version of the render state, which
+    // update() picks up at the start of the next frame. Only the render task calls setup() and update().
+    uint32_t update();
+
+    // task that calls update(), woken by xTaskNotifyGive() whenever there is something new to render
+    void setRenderTask(TaskHandle_t task);
+
+    // Realtime pixels from a light controller (see PixelStream.h): update() polls 'stream' and shows its frames
+    // instead of the clock while it runs (except for a firmware update), then returns to the time. From the render
+    // task, before the first update().
+    void setPixelStream(PixelStream* stream);
 
-    void setTime(const uint8_t hour, const uint8_t minute, const uint8_t second);
+    // every frame sent to the leds is also offered to 'mirror' (see FrameMirror.h); from the render task, before
+    // the first update()
+    void setFrameMirror(FrameMirror* mirror);
+
+    // the time shown from now on; 'second_begin_us' is the micros() at which the second began, the seconds display
+    // interpolates from it (so it may lie in the past, when the caller noticed the new second late)
+    void setTime(const uint8_t hour, const uint8_t minute, const uint8_t second, const uint32_t second_begin_us);
 
     void setSecondsMode(uint8_t seconds_mode);
-    void setSplashScreen(uint8_t splash_idx);
+    void setSplashScreen(uint8_t splash_idx);  // 0: random, 1: snake, 2: the uploaded one (see setEffect())
+
+    // 0 rotates through the time transitions, every few seconds; 1..5 only uses one of them: fade, wipe,
+    // typewriter, dissolve or the uploaded one (see setEffect(), fade while there is none)
+    void setTransition(uint8_t transition);
+
+    // An effect uploaded at runtime (see EffectVm.h), from EffectVm::load(): replaces the splash screen 2 or the
+    // uploaded transition, depending on its kind. An empty program removes that one.
+    void setEffect(const EffectVm::Program& program);
 
     void setBrightness(uint8_t value);
-    void setWordColor(uint8_t red, uint8_t green, uint8_t blue);
+    void setWordColor(uint8_t red, uint8_t green, uint8_t blue);  // the words fade to it
 
     void showWifiConnect();
     void showWifiOk();
     void showWifiError();
     void setUpdateProgress(unsigned int progress, unsigned int total);
 
+    // shows a short status text (e.g. an error code), scrolling if it is too wide, then returns to the time
+    void showText(const char* text);
+
+    uint32_t getFramesPushed();   // frames actually sent to the leds
+    uint32_t getFramesSkipped();  // frames not sent, because they did not differ from the leds' current content
+
 private:
 
     typedef enum {
@@ -52,14 +115,56 @@ private:
         S_WIFI_OK         = 2,  // 
         S_TIME_MODE       = 3,  // normal mode in which the time is displayed
         S_FWUPDATE_SCREEN = 4,  // is displayed while the software is being flashed
-        S_WIFI_ERROR      = 5   // 
+        S_WIFI_ERROR      = 5,  // 
+        S_TEXT            = 6,  // status text, see showText()
+        S_STREAM          = 7   // frames of the pixel stream, see setPixelStream()
     } State;
 
+    // Everything the other tasks tell the matrix, handed over to the render task as one consistent snapshot
+    typedef struct {
+        uint8_t  hour;
+        uint8_t  minute;
+        uint8_t  second;
+        uint32_t second_begin_us;  // micros() when the second began
+        uint8_t  seconds_mode;
+        uint8_t  brightness;
+        uint8_t  word_color[3];    // r, g, b
+        State    requested_state;  // screen asked for by the last request
+        uint16_t request_serial;   // counts the requests, so a repeated one is noticed (showText() restarts)
+        uint8_t  splash_idx;
+        uint8_t  transition;       // see setTransition()
+        uint8_t  update_pos;       // firmware update: last led of the progress bar
+        float    update_fraction;  // firmware update: progress 0..1
+        char     text[32];
+    } RenderState;
+
     typedef bool (LedMatrix::*EffectFunc)(void);
+    typedef void (LedMatrix::*TransitionStep)(uint32_t steps, uint16_t max_pixels);
+
+    // A time transition only animates the pixels that differ from the new time (see transition()). A step is due
+    // every 'interval_ms' and changes at most 'max_pixels' of them, which is the cost of a frame as long as no
+    // frame is late (then the missed steps are done in the next one).
+    typedef struct {
+        TransitionStep step;
+        uint16_t       interval_ms;
+        uint16_t       max_pixels;
+    } Transition;
+
+    // the effects uploaded at runtime, handed over like the RenderState (they are too big to copy it with them)
+    typedef struct {
+        EffectVm::Program splash;
+        EffectVm::Program transition;
+    } UserEffects;
 
-    const EffectFunc SPLASH_FUNCTIONS[2]     = { &LedMatrix::splashRandom,
-                                                 &LedMatrix::splashSnake2 };
-    const EffectFunc TRANSITION_FUNCTIONS[1] = { &LedMatrix::transFade    };
+    const EffectFunc SPLASH_FUNCTIONS[3]     = { &LedMatrix::splashRandom,
+                                                 &LedMatrix::splashSnake2,
+                                                 &LedMatrix::splashUser };
+    const Transition TRANSITION_FUNCTIONS[5] = { { &LedMatrix::transFade,       1000 / MATRIX_MAX_FPS, LED_CNT       },
+                                                 { &LedMatrix::transWipe,                          40, MATRIX_HEIGHT },
+                                                 { &LedMatrix::transTypewriter,                    25, 1             },
+                                                 { &LedMatrix::transDissolve,                      20, 4             },
+                                                 { &LedMatrix::transUser,       1000 / MATRIX_MAX_FPS, LED_CNT       } };
+    const uint8_t    TRANSITION_USER         = 4;  // index of transUser()
 
     const RgbColor BLACK  = RgbColor(  0,   0,   0);
     const RgbColor WHITE  = RgbColor(255, 255, 255);
@@ -75,39 +180,107 @@ private:
                                              {10, 9}, {9, 9}, {8, 9}, {7, 9}, {6, 9},
                                              {6, 8}, {6, 7} };
 
+    const uint16_t TEXT_SCROLL_MS = 100;   // time per pixel when scrolling text
+    const uint16_t TEXT_HOLD_MS   = 2000;  // display time of a text that fits on the matrix
+
+    // time a pixel takes to fade from black to white / from white to black (less for a shorter distance), as fast
+    // as the fades were when they went 50 / 10 steps of brightness per loop of about 5 ms
+    const uint16_t FADE_IN_MS     = 26;
+    const uint16_t FADE_OUT_MS    = 128;
+
+    const uint16_t SPLASH_USER_INTERVAL_MS = 20;  // frame interval of the uploaded splash screen
+
     bool      needs_update_;
-    uint8_t   hour_;
-    uint8_t   minute_;
-    uint8_t   second_;
-    uint16_t  millis_delta_;
+    TripleBuffer<RenderState> render_state_;  // published by the setters, read by update()
+    RenderState state_;          // the state being rendered, update()'s copy of the latest published one
+    TripleBuffer<UserEffects> user_effects_;  // published by setEffect(), read by update()
+    const UserEffects* effects_; // the latest ones, valid during update()
+    Prng      effect_prng_;      // VAR_RAND of the uploaded effects
     WordFrame word_frame_;
+    WordFrame shown_words_;      // the words the leds show once the running transition is finished
+    MatrixFrame active_;         // pixels the running transition still has to change
+    uint16_t  active_count_;     // number of pixels in active_
+    uint16_t  active_list_[LED_CNT];  // the same pixels (y * MATRIX_WIDTH + x) in no order, for picking one in O(1)
+    uint16_t  active_pos_[LED_CNT];   // per pixel: its place in active_list_ while it is active
+    MatrixFrame stale_;          // pixels painted over by something else than the time (other screens, word color)
+    MatrixFrame overlay_;        // pixels the seconds were drawn on in the last transition step
+    AnimationClock transition_clock_;  // runs since the transition became active
+    FrameBuffer::Color fade_from_[LED_CNT];  // per led: color when it became active
+    uint16_t  fade_start_[LED_CNT];    // per led: millis() when it became active (lower 16 bits)
+    FrameBuffer frame_;          // what the effects draw, output() writes it to leds_
     NeoPixelBusType& leds_;
     State     current_state_;
-    uint8_t   current_splash_idx_;
     uint8_t   current_transition_idx_;
-    uint8_t   seconds_mode_;
-    uint8_t   update_screen_progress_;
     RgbColor  color_words_;
+    uint32_t  text_start_ms_;
+    uint8_t   shown_frame_[LED_CNT * NeoGrbFeature::PixelSize];  // copy of what was last sent to the leds
+    bool      frame_pending_;    // a changed frame was held back by the frame rate limit
+    uint32_t  last_show_us_;
+    uint32_t  frames_pushed_;
+    uint32_t  frames_skipped_;
+    TaskHandle_t render_task_;
+    PixelStream* stream_;
+    FrameMirror* mirror_;
+    uint32_t  frame_delay_ms_;   // time until the next frame is due, collected during update()
+#if PROFILING_ENABLED
+    bool      frame_due_;        // update() asked to be called again at frame_due_us_
+    uint32_t  frame_due_us_;
+    bool      tick_pending_;     // a new second is not on the leds yet, it began at tick_us_
+    uint32_t  tick_us_;
+#endif
+    uint16_t  snake_path_[LED_CNT];  // led indices along the spiral of snakeStep(), see initSnake()
+    uint16_t  snake_length_;
+    RgbColor  snake_colors_[128];    // rainbow of the snake splashes, indexed by hue / 2
+
+    static RenderState initialState();
+    static UserEffects noEffects();
+    void requestState(const State new_state);
+    void applyState(const RenderState& state);
 
     void changeState(const State new_state);
 
+    void wake();
+    void requestFrame(uint32_t delay_ms);
+    bool frameDue(uint32_t *last_trigger, uint32_t interval_ms);
+
     void nextEffect();
 
+    void receiveStream();
+
     void disableLEDs();
 
+    void output();
+    void show(bool immediately = false);
+    void profileTick();
+
     uint16_t xy(const uint8_t x, const uint8_t y);
 
     const void snakeStep(uint8_t *x, uint8_t *y);
+    void initSnake();
 
     // splash screen functions:
     bool splashRandom();
     bool splashSnake();
     bool splashSnake2();
+    bool splashUser();
+
+    // time transitions:
+    bool transition();
+    void addActive(const MatrixFrame& pixels);
+    void activate(uint8_t x, uint8_t y);
+    void deactivate(uint8_t x, uint8_t y);
+    void settle(uint8_t x, uint8_t y);
+    void settleOverlay();
+    void transFade(uint32_t steps, uint16_t max_pixels);
+    void transWipe(uint32_t steps, uint16_t max_pixels);
+    void transTypewriter(uint32_t steps, uint16_t max_pixels);
+    void transDissolve(uint32_t steps, uint16_t max_pixels);
+    void transUser(uint32_t steps, uint16_t max_pixels);
+    void transSetHard(uint32_t steps, uint16_t max_pixels);
 
-    // time transition functions:
-    bool transFade();
-    bool transSetHard();
+    void runEffect(const EffectVm::Program& program, int32_t* vars, uint8_t x, uint8_t y);
 
+    uint32_t secondPhaseUs();
     void drawSecondHand();
     void drawSecondDigits();
 
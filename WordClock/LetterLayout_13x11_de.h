@@ -0,0 +1,927 @@
+// Generated by letter-layout/generate_layout.py from letter-layout/layout-13x11-de.txt -- do not edit.
+// Included by WordFrame.cpp only.
+
+#ifndef __LETTERLAYOUT_13X11_DE_H
+#define __LETTERLAYOUT_13X11_DE_H
+
+namespace LetterLayout {
+
+const uint8_t WIDTH            = 13;
+const uint8_t HEIGHT           = 11;
+const uint8_t MAX_MINUTE_WORDS = 6;
+
+typedef uint16_t Row;  // bit x = column x
+
+// letters, row by row:
+//     E S M I S T U D R E I N E
+//     Z W A N Z I G Z W E I N S
+//     S I E B E N E U N A C H T
+//     Z W Ö L F Ü N F S E C H S
+//     V I E R T E L F G Z E H N
+//     S M I N U T E N X V O R U
+//     N A C H T H A L B I E L F
+//     E I N S E C H S I E B E N
+//     F Ü N F Z W E I D R E I S
+//     K Z E H N E U N A C H T N
+//     V I E R Z W Ö L F L U H R
+
+enum WordId
+{
+    W0_ES      =  0,
+    W0_IST     =  1,
+    W0_DREI    =  2,
+    W0_EINE    =  3,
+    W1_ZWANZIG =  4,
+    W1_ZWEI    =  5,
+    W2_SIEB    =  6,
+    W2_SIEBEN  =  7,
+    W2_NEUN    =  8,
+    W2_ACHT    =  9,
+    W3_ZWOELF  = 10,
+    W3_FUENF   = 11,
+    W3_SECH    = 12,
+    W3_SECHS   = 13,
+    W4_VIER    = 14,
+    W4_VIERTEL = 15,
+    W4_ELF     = 16,
+    W4_ZEHN    = 17,
+    W5_MINUTE  = 18,
+    W5_MINUTEN = 19,
+    W5_VOR     = 20,
+    W6_NACH    = 21,
+    W6_HALB    = 22,
+    W6_ELF     = 23,
+    W7_EIN     = 24,
+    W7_EINS    = 25,
+    W7_SECHS   = 26,
+    W7_SIEBEN  = 27,
+    W8_FUENF   = 28,
+    W8_ZWEI    = 29,
+    W8_DREI    = 30,
+    W9_ZEHN    = 31,
+    W9_NEUN    = 32,
+    W9_ACHT    = 33,
+    W10_VIER   = 34,
+    W10_ZWOELF = 35,
+    W10_UHR    = 36,
+    WORD_COUNT
+};
+
+constexpr WordFrame::Word WORDS[WORD_COUNT] PROGMEM =
+{
+    {  0,  0,  2 },  // W0_ES
+    {  3,  0,  3 },  // W0_IST
+    {  7,  0,  4 },  // W0_DREI
+    {  9,  0,  4 },  // W0_EINE
+    {  0,  1,  7 },  // W1_ZWANZIG
+    {  7,  1,  4 },  // W1_ZWEI
+    {  0,  2,  4 },  // W2_SIEB
+    {  0,  2,  6 },  // W2_SIEBEN
+    {  5,  2,  4 },  // W2_NEUN
+    {  9,  2,  4 },  // W2_ACHT
+    {  0,  3,  5 },  // W3_ZWOELF
+    {  4,  3,  4 },  // W3_FUENF
+    {  8,  3,  4 },  // W3_SECH
+    {  8,  3,  5 },  // W3_SECHS
+    {  0,  4,  4 },  // W4_VIER
+    {  0,  4,  7 },  // W4_VIERTEL
+    {  5,  4,  3 },  // W4_ELF
+    {  9,  4,  4 },  // W4_ZEHN
+    {  1,  5,  6 },  // W5_MINUTE
+    {  1,  5,  7 },  // W5_MINUTEN
+    {  9,  5,  3 },  // W5_VOR
+    {  0,  6,  4 },  // W6_NACH
+    {  5,  6,  4 },  // W6_HALB
+    { 10,  6,  3 },  // W6_ELF
+    {  0,  7,  3 },  // W7_EIN
+    {  0,  7,  4 },  // W7_EINS
+    {  3,  7,  5 },  // W7_SECHS
+    {  7,  7,  6 },  // W7_SIEBEN
+    {  0,  8,  4 },  // W8_FUENF
+    {  4,  8,  4 },  // W8_ZWEI
+    {  8,  8,  4 },  // W8_DREI
+    {  1,  9,  4 },  // W9_ZEHN
+    {  4,  9,  4 },  // W9_NEUN
+    {  8,  9,  4 },  // W9_ACHT
+    {  0, 10,  4 },  // W10_VIER
+    {  4, 10,  5 },  // W10_ZWOELF
+    { 10, 10,  3 },  // W10_UHR
+};
+
+typedef struct
+{
+    uint8_t hour_offset;               // 0: the current hour, 1: the next one
+    uint8_t hour_form;                 // index into HOUR_WORDS[hour]
+    uint8_t word_count;
+    uint8_t words[MAX_MINUTE_WORDS];   // WordId
+} MinuteRule;
+
+constexpr MinuteRule MINUTE_RULES[60] PROGMEM =
+{
+    { 0, 1, 3, { W0_ES, W0_IST, W10_UHR } },  //  0: ES IST {H.full} UHR
+    { 0, 0, 5, { W0_ES, W0_IST, W0_EINE, W5_MINUTE, W6_NACH } },  //  1: ES IST EINE MINUTE NACH {H}
+    { 0, 0, 5, { W0_ES, W0_IST, W1_ZWEI, W5_MINUTEN, W6_NACH } },  //  2: ES IST ZWEI MINUTEN NACH {H}
+    { 0, 0, 5, { W0_ES, W0_IST, W0_DREI, W5_MINUTEN, W6_NACH } },  //  3: ES IST DREI MINUTEN NACH {H}
+    { 0, 0, 5, { W0_ES, W0_IST, W4_VIER, W5_MINUTEN, W6_NACH } },  //  4: ES IST VIER MINUTEN NACH {H}
+    { 0, 0, 4, { W0_ES, W0_IST, W3_FUENF, W6_NACH } },  //  5: ES IST FÜNF NACH {H}
+    { 0, 0, 5, { W0_ES, W0_IST, W3_SECHS, W5_MINUTEN, W6_NACH } },  //  6: ES IST SECHS MINUTEN NACH {H}
+    { 0, 0, 5, { W0_ES, W0_IST, W2_SIEBEN, W5_MINUTEN, W6_NACH } },  //  7: ES IST SIEBEN MINUTEN NACH {H}
+    { 0, 0, 5, { W0_ES, W0_IST, W2_ACHT, W5_MINUTEN, W6_NACH } },  //  8: ES IST ACHT MINUTEN NACH {H}
+    { 0, 0, 5, { W0_ES, W0_IST, W2_NEUN, W5_MINUTEN, W6_NACH } },  //  9: ES IST NEUN MINUTEN NACH {H}
+    { 0, 0, 4, { W0_ES, W0_IST, W4_ZEHN, W6_NACH } },  // 10: ES IST ZEHN NACH {H}
+    { 0, 0, 5, { W0_ES, W0_IST, W4_ELF, W5_MINUTEN, W6_NACH } },  // 11: ES IST ELF MINUTEN NACH {H}
+    { 0, 0, 5, { W0_ES, W0_IST, W3_ZWOELF, W5_MINUTEN, W6_NACH } },  // 12: ES IST ZWÖLF MINUTEN NACH {H}
+    { 0, 0, 6, { W0_ES, W0_IST, W0_DREI, W4_ZEHN, W5_MINUTEN, W6_NACH } },  // 13: ES IST DREI ZEHN MINUTEN NACH {H}
+    { 0, 0, 6, { W0_ES, W0_IST, W4_VIER, W4_ZEHN, W5_MINUTEN, W6_NACH } },  // 14: ES IST VIER ZEHN MINUTEN NACH {H}
+    { 0, 0, 4, { W0_ES, W0_IST, W4_VIERTEL, W6_NACH } },  // 15: ES IST VIERTEL NACH {H}
+    { 0, 0, 6, { W0_ES, W0_IST, W3_SECH, W4_ZEHN, W5_MINUTEN, W6_NACH } },  // 16: ES IST SECH ZEHN MINUTEN NACH {H}
+    { 0, 0, 6, { W0_ES, W0_IST, W2_SIEB, W4_ZEHN, W5_MINUTEN, W6_NACH } },  // 17: ES IST SIEB ZEHN MINUTEN NACH {H}
+    { 0, 0, 6, { W0_ES, W0_IST, W2_ACHT, W4_ZEHN, W5_MINUTEN, W6_NACH } },  // 18: ES IST ACHT ZEHN MINUTEN NACH {H}
+    { 0, 0, 6, { W0_ES, W0_IST, W2_NEUN, W4_ZEHN, W5_MINUTEN, W6_NACH } },  // 19: ES IST NEUN ZEHN MINUTEN NACH {H}
+    { 0, 0, 4, { W0_ES, W0_IST, W1_ZWANZIG, W6_NACH } },  // 20: ES IST ZWANZIG NACH@6 {H}
+    { 1, 0, 6, { W0_ES, W0_IST, W2_NEUN, W5_MINUTEN, W5_VOR, W6_HALB } },  // 21: ES IST NEUN MINUTEN VOR HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W2_ACHT, W5_MINUTEN, W5_VOR, W6_HALB } },  // 22: ES IST ACHT MINUTEN VOR HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W2_SIEBEN, W5_MINUTEN, W5_VOR, W6_HALB } },  // 23: ES IST SIEBEN MINUTEN VOR HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W3_SECHS, W5_MINUTEN, W5_VOR, W6_HALB } },  // 24: ES IST SECHS MINUTEN VOR HALB {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W3_FUENF, W5_VOR, W6_HALB } },  // 25: ES IST FÜNF VOR HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W4_VIER, W5_MINUTEN, W5_VOR, W6_HALB } },  // 26: ES IST VIER MINUTEN VOR HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W0_DREI, W5_MINUTEN, W5_VOR, W6_HALB } },  // 27: ES IST DREI MINUTEN VOR HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W1_ZWEI, W5_MINUTEN, W5_VOR, W6_HALB } },  // 28: ES IST ZWEI MINUTEN VOR HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W0_EINE, W5_MINUTE, W5_VOR, W6_HALB } },  // 29: ES IST EINE MINUTE VOR HALB {H+1}
+    { 1, 0, 3, { W0_ES, W0_IST, W6_HALB } },  // 30: ES IST HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W0_EINE, W5_MINUTE, W6_NACH, W6_HALB } },  // 31: ES IST EINE MINUTE NACH HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W1_ZWEI, W5_MINUTEN, W6_NACH, W6_HALB } },  // 32: ES IST ZWEI MINUTEN NACH HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W0_DREI, W5_MINUTEN, W6_NACH, W6_HALB } },  // 33: ES IST DREI MINUTEN NACH HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W4_VIER, W5_MINUTEN, W6_NACH, W6_HALB } },  // 34: ES IST VIER MINUTEN NACH HALB {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W3_FUENF, W6_NACH, W6_HALB } },  // 35: ES IST FÜNF NACH HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W3_SECHS, W5_MINUTEN, W6_NACH, W6_HALB } },  // 36: ES IST SECHS MINUTEN NACH HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W2_SIEBEN, W5_MINUTEN, W6_NACH, W6_HALB } },  // 37: ES IST SIEBEN MINUTEN NACH HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W2_ACHT, W5_MINUTEN, W6_NACH, W6_HALB } },  // 38: ES IST ACHT MINUTEN NACH HALB {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W2_NEUN, W5_MINUTEN, W6_NACH, W6_HALB } },  // 39: ES IST NEUN MINUTEN NACH HALB {H+1}
+    { 1, 0, 4, { W0_ES, W0_IST, W1_ZWANZIG, W5_VOR } },  // 40: ES IST ZWANZIG VOR {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W2_NEUN, W4_ZEHN, W5_MINUTEN, W5_VOR } },  // 41: ES IST NEUN ZEHN MINUTEN VOR {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W2_ACHT, W4_ZEHN, W5_MINUTEN, W5_VOR } },  // 42: ES IST ACHT ZEHN MINUTEN VOR {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W2_SIEB, W4_ZEHN, W5_MINUTEN, W5_VOR } },  // 43: ES IST SIEB ZEHN MINUTEN VOR {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W3_SECH, W4_ZEHN, W5_MINUTEN, W5_VOR } },  // 44: ES IST SECH ZEHN MINUTEN VOR {H+1}
+    { 1, 0, 4, { W0_ES, W0_IST, W4_VIERTEL, W5_VOR } },  // 45: ES IST VIERTEL VOR {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W4_VIER, W4_ZEHN, W5_MINUTEN, W5_VOR } },  // 46: ES IST VIER ZEHN MINUTEN VOR {H+1}
+    { 1, 0, 6, { W0_ES, W0_IST, W0_DREI, W4_ZEHN, W5_MINUTEN, W5_VOR } },  // 47: ES IST DREI ZEHN MINUTEN VOR {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W3_ZWOELF, W5_MINUTEN, W5_VOR } },  // 48: ES IST ZWÖLF MINUTEN VOR {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W4_ELF, W5_MINUTEN, W5_VOR } },  // 49: ES IST ELF MINUTEN VOR {H+1}
+    { 1, 0, 4, { W0_ES, W0_IST, W4_ZEHN, W5_VOR } },  // 50: ES IST ZEHN VOR {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W2_NEUN, W5_MINUTEN, W5_VOR } },  // 51: ES IST NEUN MINUTEN VOR {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W2_ACHT, W5_MINUTEN, W5_VOR } },  // 52: ES IST ACHT MINUTEN VOR {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W2_SIEBEN, W5_MINUTEN, W5_VOR } },  // 53: ES IST SIEBEN MINUTEN VOR {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W3_SECHS, W5_MINUTEN, W5_VOR } },  // 54: ES IST SECHS MINUTEN VOR {H+1}
+    { 1, 0, 4, { W0_ES, W0_IST, W3_FUENF, W5_VOR } },  // 55: ES IST FÜNF VOR {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W4_VIER, W5_MINUTEN, W5_VOR } },  // 56: ES IST VIER MINUTEN VOR {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W0_DREI, W5_MINUTEN, W5_VOR } },  // 57: ES IST DREI MINUTEN VOR {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W1_ZWEI, W5_MINUTEN, W5_VOR } },  // 58: ES IST ZWEI MINUTEN VOR {H+1}
+    { 1, 0, 5, { W0_ES, W0_IST, W0_EINE, W5_MINUTE, W5_VOR } },  // 59: ES IST EINE MINUTE VOR {H+1}
+};
+
+// per hour: the word, the word at the full hour
+constexpr uint8_t HOUR_WORDS[12][2] PROGMEM =
+{
+    { W10_ZWOELF, W10_ZWOELF },  //  0
+    { W7_EINS, W7_EIN },  //  1
+    { W8_ZWEI, W8_ZWEI },  //  2
+    { W8_DREI, W8_DREI },  //  3
+    { W10_VIER, W10_VIER },  //  4
+    { W8_FUENF, W8_FUENF },  //  5
+    { W7_SECHS, W7_SECHS },  //  6
+    { W7_SIEBEN, W7_SIEBEN },  //  7
+    { W9_ACHT, W9_ACHT },  //  8
+    { W9_NEUN, W9_NEUN },  //  9
+    { W9_ZEHN, W9_ZEHN },  // 10
+    { W6_ELF, W6_ELF },  // 11
+};
+
+// the rows of the mask of every time of day, index: hour * 60 + minute
+constexpr Row TIME_MASKS[12 * 60][HEIGHT] PROGMEM =
+{
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1df0 },  // 00:00 ES IST ZWÖLF UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:01 ES IST EINE MINUTE NACH ZWÖLF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:02 ES IST ZWEI MINUTEN NACH ZWÖLF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:03 ES IST DREI MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:04 ES IST VIER MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:05 ES IST FÜNF NACH ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:06 ES IST SECHS MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:07 ES IST SIEBEN MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:08 ES IST ACHT MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:09 ES IST NEUN MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:10 ES IST ZEHN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:11 ES IST ELF MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:12 ES IST ZWÖLF MINUTEN NACH ZWÖLF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:13 ES IST DREI ZEHN MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:14 ES IST VIER ZEHN MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:15 ES IST VIERTEL NACH ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:16 ES IST SECH ZEHN MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:17 ES IST SIEB ZEHN MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:18 ES IST ACHT ZEHN MINUTEN NACH ZWÖLF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:19 ES IST NEUN ZEHN MINUTEN NACH ZWÖLF
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 00:20 ES IST ZWANZIG NACH ZWÖLF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:21 ES IST NEUN MINUTEN VOR HALB EINS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:22 ES IST ACHT MINUTEN VOR HALB EINS
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:23 ES IST SIEBEN MINUTEN VOR HALB EINS
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x01e0, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:24 ES IST SECHS MINUTEN VOR HALB EINS
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x01e0, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:25 ES IST FÜNF VOR HALB EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x01e0, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:26 ES IST VIER MINUTEN VOR HALB EINS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:27 ES IST DREI MINUTEN VOR HALB EINS
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:28 ES IST ZWEI MINUTEN VOR HALB EINS
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x01e0, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:29 ES IST EINE MINUTE VOR HALB EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e0, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:30 ES IST HALB EINS
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01ef, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:31 ES IST EINE MINUTE NACH HALB EINS
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:32 ES IST ZWEI MINUTEN NACH HALB EINS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:33 ES IST DREI MINUTEN NACH HALB EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x01ef, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:34 ES IST VIER MINUTEN NACH HALB EINS
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x01ef, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:35 ES IST FÜNF NACH HALB EINS
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x01ef, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:36 ES IST SECHS MINUTEN NACH HALB EINS
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:37 ES IST SIEBEN MINUTEN NACH HALB EINS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:38 ES IST ACHT MINUTEN NACH HALB EINS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:39 ES IST NEUN MINUTEN NACH HALB EINS
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:40 ES IST ZWANZIG VOR EINS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:41 ES IST NEUN ZEHN MINUTEN VOR EINS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:42 ES IST ACHT ZEHN MINUTEN VOR EINS
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:43 ES IST SIEB ZEHN MINUTEN VOR EINS
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:44 ES IST SECH ZEHN MINUTEN VOR EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:45 ES IST VIERTEL VOR EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:46 ES IST VIER ZEHN MINUTEN VOR EINS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:47 ES IST DREI ZEHN MINUTEN VOR EINS
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:48 ES IST ZWÖLF MINUTEN VOR EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:49 ES IST ELF MINUTEN VOR EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:50 ES IST ZEHN VOR EINS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:51 ES IST NEUN MINUTEN VOR EINS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:52 ES IST ACHT MINUTEN VOR EINS
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:53 ES IST SIEBEN MINUTEN VOR EINS
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:54 ES IST SECHS MINUTEN VOR EINS
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:55 ES IST FÜNF VOR EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:56 ES IST VIER MINUTEN VOR EINS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:57 ES IST DREI MINUTEN VOR EINS
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:58 ES IST ZWEI MINUTEN VOR EINS
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000 },  // 00:59 ES IST EINE MINUTE VOR EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x1c00 },  // 01:00 ES IST EIN UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:01 ES IST EINE MINUTE NACH EINS
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:02 ES IST ZWEI MINUTEN NACH EINS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:03 ES IST DREI MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:04 ES IST VIER MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:05 ES IST FÜNF NACH EINS
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:06 ES IST SECHS MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:07 ES IST SIEBEN MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:08 ES IST ACHT MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:09 ES IST NEUN MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:10 ES IST ZEHN NACH EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:11 ES IST ELF MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:12 ES IST ZWÖLF MINUTEN NACH EINS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:13 ES IST DREI ZEHN MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:14 ES IST VIER ZEHN MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:15 ES IST VIERTEL NACH EINS
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:16 ES IST SECH ZEHN MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:17 ES IST SIEB ZEHN MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:18 ES IST ACHT ZEHN MINUTEN NACH EINS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:19 ES IST NEUN ZEHN MINUTEN NACH EINS
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x000f, 0x0000, 0x0000, 0x0000 },  // 01:20 ES IST ZWANZIG NACH EINS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:21 ES IST NEUN MINUTEN VOR HALB ZWEI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:22 ES IST ACHT MINUTEN VOR HALB ZWEI
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:23 ES IST SIEBEN MINUTEN VOR HALB ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:24 ES IST SECHS MINUTEN VOR HALB ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x01e0, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:25 ES IST FÜNF VOR HALB ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x01e0, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:26 ES IST VIER MINUTEN VOR HALB ZWEI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:27 ES IST DREI MINUTEN VOR HALB ZWEI
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:28 ES IST ZWEI MINUTEN VOR HALB ZWEI
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x01e0, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:29 ES IST EINE MINUTE VOR HALB ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e0, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:30 ES IST HALB ZWEI
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01ef, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:31 ES IST EINE MINUTE NACH HALB ZWEI
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:32 ES IST ZWEI MINUTEN NACH HALB ZWEI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:33 ES IST DREI MINUTEN NACH HALB ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x01ef, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:34 ES IST VIER MINUTEN NACH HALB ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x01ef, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:35 ES IST FÜNF NACH HALB ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:36 ES IST SECHS MINUTEN NACH HALB ZWEI
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:37 ES IST SIEBEN MINUTEN NACH HALB ZWEI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:38 ES IST ACHT MINUTEN NACH HALB ZWEI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:39 ES IST NEUN MINUTEN NACH HALB ZWEI
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:40 ES IST ZWANZIG VOR ZWEI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:41 ES IST NEUN ZEHN MINUTEN VOR ZWEI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:42 ES IST ACHT ZEHN MINUTEN VOR ZWEI
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:43 ES IST SIEB ZEHN MINUTEN VOR ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:44 ES IST SECH ZEHN MINUTEN VOR ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:45 ES IST VIERTEL VOR ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:46 ES IST VIER ZEHN MINUTEN VOR ZWEI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:47 ES IST DREI ZEHN MINUTEN VOR ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:48 ES IST ZWÖLF MINUTEN VOR ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:49 ES IST ELF MINUTEN VOR ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:50 ES IST ZEHN VOR ZWEI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:51 ES IST NEUN MINUTEN VOR ZWEI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:52 ES IST ACHT MINUTEN VOR ZWEI
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:53 ES IST SIEBEN MINUTEN VOR ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:54 ES IST SECHS MINUTEN VOR ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:55 ES IST FÜNF VOR ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:56 ES IST VIER MINUTEN VOR ZWEI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:57 ES IST DREI MINUTEN VOR ZWEI
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:58 ES IST ZWEI MINUTEN VOR ZWEI
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 01:59 ES IST EINE MINUTE VOR ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000, 0x1c00 },  // 02:00 ES IST ZWEI UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:01 ES IST EINE MINUTE NACH ZWEI
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:02 ES IST ZWEI MINUTEN NACH ZWEI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:03 ES IST DREI MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:04 ES IST VIER MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:05 ES IST FÜNF NACH ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:06 ES IST SECHS MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:07 ES IST SIEBEN MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:08 ES IST ACHT MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:09 ES IST NEUN MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:10 ES IST ZEHN NACH ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:11 ES IST ELF MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:12 ES IST ZWÖLF MINUTEN NACH ZWEI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:13 ES IST DREI ZEHN MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:14 ES IST VIER ZEHN MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:15 ES IST VIERTEL NACH ZWEI
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:16 ES IST SECH ZEHN MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:17 ES IST SIEB ZEHN MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:18 ES IST ACHT ZEHN MINUTEN NACH ZWEI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:19 ES IST NEUN ZEHN MINUTEN NACH ZWEI
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x0000, 0x00f0, 0x0000, 0x0000 },  // 02:20 ES IST ZWANZIG NACH ZWEI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:21 ES IST NEUN MINUTEN VOR HALB DREI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:22 ES IST ACHT MINUTEN VOR HALB DREI
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:23 ES IST SIEBEN MINUTEN VOR HALB DREI
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:24 ES IST SECHS MINUTEN VOR HALB DREI
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x01e0, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:25 ES IST FÜNF VOR HALB DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x01e0, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:26 ES IST VIER MINUTEN VOR HALB DREI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:27 ES IST DREI MINUTEN VOR HALB DREI
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:28 ES IST ZWEI MINUTEN VOR HALB DREI
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x01e0, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:29 ES IST EINE MINUTE VOR HALB DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e0, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:30 ES IST HALB DREI
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01ef, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:31 ES IST EINE MINUTE NACH HALB DREI
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:32 ES IST ZWEI MINUTEN NACH HALB DREI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:33 ES IST DREI MINUTEN NACH HALB DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x01ef, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:34 ES IST VIER MINUTEN NACH HALB DREI
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x01ef, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:35 ES IST FÜNF NACH HALB DREI
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:36 ES IST SECHS MINUTEN NACH HALB DREI
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:37 ES IST SIEBEN MINUTEN NACH HALB DREI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:38 ES IST ACHT MINUTEN NACH HALB DREI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:39 ES IST NEUN MINUTEN NACH HALB DREI
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:40 ES IST ZWANZIG VOR DREI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:41 ES IST NEUN ZEHN MINUTEN VOR DREI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:42 ES IST ACHT ZEHN MINUTEN VOR DREI
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:43 ES IST SIEB ZEHN MINUTEN VOR DREI
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:44 ES IST SECH ZEHN MINUTEN VOR DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:45 ES IST VIERTEL VOR DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:46 ES IST VIER ZEHN MINUTEN VOR DREI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:47 ES IST DREI ZEHN MINUTEN VOR DREI
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:48 ES IST ZWÖLF MINUTEN VOR DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:49 ES IST ELF MINUTEN VOR DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:50 ES IST ZEHN VOR DREI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:51 ES IST NEUN MINUTEN VOR DREI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:52 ES IST ACHT MINUTEN VOR DREI
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:53 ES IST SIEBEN MINUTEN VOR DREI
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:54 ES IST SECHS MINUTEN VOR DREI
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:55 ES IST FÜNF VOR DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:56 ES IST VIER MINUTEN VOR DREI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:57 ES IST DREI MINUTEN VOR DREI
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:58 ES IST ZWEI MINUTEN VOR DREI
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 02:59 ES IST EINE MINUTE VOR DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000, 0x1c00 },  // 03:00 ES IST DREI UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:01 ES IST EINE MINUTE NACH DREI
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:02 ES IST ZWEI MINUTEN NACH DREI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:03 ES IST DREI MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:04 ES IST VIER MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:05 ES IST FÜNF NACH DREI
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:06 ES IST SECHS MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:07 ES IST SIEBEN MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:08 ES IST ACHT MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:09 ES IST NEUN MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:10 ES IST ZEHN NACH DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:11 ES IST ELF MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:12 ES IST ZWÖLF MINUTEN NACH DREI
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:13 ES IST DREI ZEHN MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:14 ES IST VIER ZEHN MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:15 ES IST VIERTEL NACH DREI
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:16 ES IST SECH ZEHN MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:17 ES IST SIEB ZEHN MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:18 ES IST ACHT ZEHN MINUTEN NACH DREI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:19 ES IST NEUN ZEHN MINUTEN NACH DREI
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x0000, 0x0f00, 0x0000, 0x0000 },  // 03:20 ES IST ZWANZIG NACH DREI
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:21 ES IST NEUN MINUTEN VOR HALB VIER
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:22 ES IST ACHT MINUTEN VOR HALB VIER
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:23 ES IST SIEBEN MINUTEN VOR HALB VIER
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:24 ES IST SECHS MINUTEN VOR HALB VIER
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x01e0, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:25 ES IST FÜNF VOR HALB VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:26 ES IST VIER MINUTEN VOR HALB VIER
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:27 ES IST DREI MINUTEN VOR HALB VIER
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:28 ES IST ZWEI MINUTEN VOR HALB VIER
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x01e0, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:29 ES IST EINE MINUTE VOR HALB VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:30 ES IST HALB VIER
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01ef, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:31 ES IST EINE MINUTE NACH HALB VIER
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:32 ES IST ZWEI MINUTEN NACH HALB VIER
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:33 ES IST DREI MINUTEN NACH HALB VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:34 ES IST VIER MINUTEN NACH HALB VIER
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x01ef, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:35 ES IST FÜNF NACH HALB VIER
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:36 ES IST SECHS MINUTEN NACH HALB VIER
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:37 ES IST SIEBEN MINUTEN NACH HALB VIER
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:38 ES IST ACHT MINUTEN NACH HALB VIER
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:39 ES IST NEUN MINUTEN NACH HALB VIER
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:40 ES IST ZWANZIG VOR VIER
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:41 ES IST NEUN ZEHN MINUTEN VOR VIER
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:42 ES IST ACHT ZEHN MINUTEN VOR VIER
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:43 ES IST SIEB ZEHN MINUTEN VOR VIER
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:44 ES IST SECH ZEHN MINUTEN VOR VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:45 ES IST VIERTEL VOR VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:46 ES IST VIER ZEHN MINUTEN VOR VIER
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:47 ES IST DREI ZEHN MINUTEN VOR VIER
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:48 ES IST ZWÖLF MINUTEN VOR VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:49 ES IST ELF MINUTEN VOR VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:50 ES IST ZEHN VOR VIER
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:51 ES IST NEUN MINUTEN VOR VIER
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:52 ES IST ACHT MINUTEN VOR VIER
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:53 ES IST SIEBEN MINUTEN VOR VIER
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:54 ES IST SECHS MINUTEN VOR VIER
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:55 ES IST FÜNF VOR VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:56 ES IST VIER MINUTEN VOR VIER
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:57 ES IST DREI MINUTEN VOR VIER
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:58 ES IST ZWEI MINUTEN VOR VIER
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f },  // 03:59 ES IST EINE MINUTE VOR VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c0f },  // 04:00 ES IST VIER UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:01 ES IST EINE MINUTE NACH VIER
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:02 ES IST ZWEI MINUTEN NACH VIER
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:03 ES IST DREI MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:04 ES IST VIER MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:05 ES IST FÜNF NACH VIER
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:06 ES IST SECHS MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:07 ES IST SIEBEN MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:08 ES IST ACHT MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:09 ES IST NEUN MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:10 ES IST ZEHN NACH VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:11 ES IST ELF MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:12 ES IST ZWÖLF MINUTEN NACH VIER
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:13 ES IST DREI ZEHN MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:14 ES IST VIER ZEHN MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:15 ES IST VIERTEL NACH VIER
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:16 ES IST SECH ZEHN MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:17 ES IST SIEB ZEHN MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:18 ES IST ACHT ZEHN MINUTEN NACH VIER
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:19 ES IST NEUN ZEHN MINUTEN NACH VIER
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000, 0x000f },  // 04:20 ES IST ZWANZIG NACH VIER
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:21 ES IST NEUN MINUTEN VOR HALB FÜNF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:22 ES IST ACHT MINUTEN VOR HALB FÜNF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:23 ES IST SIEBEN MINUTEN VOR HALB FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:24 ES IST SECHS MINUTEN VOR HALB FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x01e0, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:25 ES IST FÜNF VOR HALB FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x01e0, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:26 ES IST VIER MINUTEN VOR HALB FÜNF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:27 ES IST DREI MINUTEN VOR HALB FÜNF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:28 ES IST ZWEI MINUTEN VOR HALB FÜNF
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x01e0, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:29 ES IST EINE MINUTE VOR HALB FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e0, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:30 ES IST HALB FÜNF
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01ef, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:31 ES IST EINE MINUTE NACH HALB FÜNF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:32 ES IST ZWEI MINUTEN NACH HALB FÜNF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:33 ES IST DREI MINUTEN NACH HALB FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x01ef, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:34 ES IST VIER MINUTEN NACH HALB FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x01ef, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:35 ES IST FÜNF NACH HALB FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:36 ES IST SECHS MINUTEN NACH HALB FÜNF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:37 ES IST SIEBEN MINUTEN NACH HALB FÜNF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:38 ES IST ACHT MINUTEN NACH HALB FÜNF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:39 ES IST NEUN MINUTEN NACH HALB FÜNF
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:40 ES IST ZWANZIG VOR FÜNF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:41 ES IST NEUN ZEHN MINUTEN VOR FÜNF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:42 ES IST ACHT ZEHN MINUTEN VOR FÜNF
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:43 ES IST SIEB ZEHN MINUTEN VOR FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:44 ES IST SECH ZEHN MINUTEN VOR FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:45 ES IST VIERTEL VOR FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:46 ES IST VIER ZEHN MINUTEN VOR FÜNF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:47 ES IST DREI ZEHN MINUTEN VOR FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:48 ES IST ZWÖLF MINUTEN VOR FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:49 ES IST ELF MINUTEN VOR FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:50 ES IST ZEHN VOR FÜNF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:51 ES IST NEUN MINUTEN VOR FÜNF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:52 ES IST ACHT MINUTEN VOR FÜNF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:53 ES IST SIEBEN MINUTEN VOR FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:54 ES IST SECHS MINUTEN VOR FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:55 ES IST FÜNF VOR FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:56 ES IST VIER MINUTEN VOR FÜNF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:57 ES IST DREI MINUTEN VOR FÜNF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:58 ES IST ZWEI MINUTEN VOR FÜNF
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000 },  // 04:59 ES IST EINE MINUTE VOR FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x0000, 0x1c00 },  // 05:00 ES IST FÜNF UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:01 ES IST EINE MINUTE NACH FÜNF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:02 ES IST ZWEI MINUTEN NACH FÜNF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:03 ES IST DREI MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:04 ES IST VIER MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:05 ES IST FÜNF NACH FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:06 ES IST SECHS MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:07 ES IST SIEBEN MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:08 ES IST ACHT MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:09 ES IST NEUN MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:10 ES IST ZEHN NACH FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:11 ES IST ELF MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:12 ES IST ZWÖLF MINUTEN NACH FÜNF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:13 ES IST DREI ZEHN MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:14 ES IST VIER ZEHN MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:15 ES IST VIERTEL NACH FÜNF
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:16 ES IST SECH ZEHN MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:17 ES IST SIEB ZEHN MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:18 ES IST ACHT ZEHN MINUTEN NACH FÜNF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:19 ES IST NEUN ZEHN MINUTEN NACH FÜNF
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x0000, 0x000f, 0x0000, 0x0000 },  // 05:20 ES IST ZWANZIG NACH FÜNF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:21 ES IST NEUN MINUTEN VOR HALB SECHS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:22 ES IST ACHT MINUTEN VOR HALB SECHS
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:23 ES IST SIEBEN MINUTEN VOR HALB SECHS
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x01e0, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:24 ES IST SECHS MINUTEN VOR HALB SECHS
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x01e0, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:25 ES IST FÜNF VOR HALB SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x01e0, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:26 ES IST VIER MINUTEN VOR HALB SECHS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:27 ES IST DREI MINUTEN VOR HALB SECHS
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:28 ES IST ZWEI MINUTEN VOR HALB SECHS
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x01e0, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:29 ES IST EINE MINUTE VOR HALB SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e0, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:30 ES IST HALB SECHS
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01ef, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:31 ES IST EINE MINUTE NACH HALB SECHS
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:32 ES IST ZWEI MINUTEN NACH HALB SECHS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:33 ES IST DREI MINUTEN NACH HALB SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x01ef, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:34 ES IST VIER MINUTEN NACH HALB SECHS
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x01ef, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:35 ES IST FÜNF NACH HALB SECHS
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x01ef, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:36 ES IST SECHS MINUTEN NACH HALB SECHS
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:37 ES IST SIEBEN MINUTEN NACH HALB SECHS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:38 ES IST ACHT MINUTEN NACH HALB SECHS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:39 ES IST NEUN MINUTEN NACH HALB SECHS
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:40 ES IST ZWANZIG VOR SECHS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:41 ES IST NEUN ZEHN MINUTEN VOR SECHS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:42 ES IST ACHT ZEHN MINUTEN VOR SECHS
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:43 ES IST SIEB ZEHN MINUTEN VOR SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:44 ES IST SECH ZEHN MINUTEN VOR SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:45 ES IST VIERTEL VOR SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:46 ES IST VIER ZEHN MINUTEN VOR SECHS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:47 ES IST DREI ZEHN MINUTEN VOR SECHS
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:48 ES IST ZWÖLF MINUTEN VOR SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:49 ES IST ELF MINUTEN VOR SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:50 ES IST ZEHN VOR SECHS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:51 ES IST NEUN MINUTEN VOR SECHS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:52 ES IST ACHT MINUTEN VOR SECHS
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:53 ES IST SIEBEN MINUTEN VOR SECHS
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:54 ES IST SECHS MINUTEN VOR SECHS
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:55 ES IST FÜNF VOR SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:56 ES IST VIER MINUTEN VOR SECHS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:57 ES IST DREI MINUTEN VOR SECHS
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:58 ES IST ZWEI MINUTEN VOR SECHS
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x0000, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 05:59 ES IST EINE MINUTE VOR SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00f8, 0x0000, 0x0000, 0x1c00 },  // 06:00 ES IST SECHS UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:01 ES IST EINE MINUTE NACH SECHS
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:02 ES IST ZWEI MINUTEN NACH SECHS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:03 ES IST DREI MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:04 ES IST VIER MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:05 ES IST FÜNF NACH SECHS
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:06 ES IST SECHS MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:07 ES IST SIEBEN MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:08 ES IST ACHT MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:09 ES IST NEUN MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:10 ES IST ZEHN NACH SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:11 ES IST ELF MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:12 ES IST ZWÖLF MINUTEN NACH SECHS
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:13 ES IST DREI ZEHN MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:14 ES IST VIER ZEHN MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:15 ES IST VIERTEL NACH SECHS
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:16 ES IST SECH ZEHN MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:17 ES IST SIEB ZEHN MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:18 ES IST ACHT ZEHN MINUTEN NACH SECHS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:19 ES IST NEUN ZEHN MINUTEN NACH SECHS
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x00f8, 0x0000, 0x0000, 0x0000 },  // 06:20 ES IST ZWANZIG NACH SECHS
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:21 ES IST NEUN MINUTEN VOR HALB SIEBEN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:22 ES IST ACHT MINUTEN VOR HALB SIEBEN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:23 ES IST SIEBEN MINUTEN VOR HALB SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x01e0, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:24 ES IST SECHS MINUTEN VOR HALB SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x01e0, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:25 ES IST FÜNF VOR HALB SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x01e0, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:26 ES IST VIER MINUTEN VOR HALB SIEBEN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:27 ES IST DREI MINUTEN VOR HALB SIEBEN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:28 ES IST ZWEI MINUTEN VOR HALB SIEBEN
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x01e0, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:29 ES IST EINE MINUTE VOR HALB SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e0, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:30 ES IST HALB SIEBEN
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01ef, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:31 ES IST EINE MINUTE NACH HALB SIEBEN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:32 ES IST ZWEI MINUTEN NACH HALB SIEBEN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:33 ES IST DREI MINUTEN NACH HALB SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x01ef, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:34 ES IST VIER MINUTEN NACH HALB SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x01ef, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:35 ES IST FÜNF NACH HALB SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x01ef, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:36 ES IST SECHS MINUTEN NACH HALB SIEBEN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:37 ES IST SIEBEN MINUTEN NACH HALB SIEBEN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:38 ES IST ACHT MINUTEN NACH HALB SIEBEN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:39 ES IST NEUN MINUTEN NACH HALB SIEBEN
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:40 ES IST ZWANZIG VOR SIEBEN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:41 ES IST NEUN ZEHN MINUTEN VOR SIEBEN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:42 ES IST ACHT ZEHN MINUTEN VOR SIEBEN
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:43 ES IST SIEB ZEHN MINUTEN VOR SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:44 ES IST SECH ZEHN MINUTEN VOR SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:45 ES IST VIERTEL VOR SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:46 ES IST VIER ZEHN MINUTEN VOR SIEBEN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:47 ES IST DREI ZEHN MINUTEN VOR SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:48 ES IST ZWÖLF MINUTEN VOR SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:49 ES IST ELF MINUTEN VOR SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:50 ES IST ZEHN VOR SIEBEN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:51 ES IST NEUN MINUTEN VOR SIEBEN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:52 ES IST ACHT MINUTEN VOR SIEBEN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:53 ES IST SIEBEN MINUTEN VOR SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:54 ES IST SECHS MINUTEN VOR SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:55 ES IST FÜNF VOR SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:56 ES IST VIER MINUTEN VOR SIEBEN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:57 ES IST DREI MINUTEN VOR SIEBEN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:58 ES IST ZWEI MINUTEN VOR SIEBEN
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x0000, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 06:59 ES IST EINE MINUTE VOR SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f80, 0x0000, 0x0000, 0x1c00 },  // 07:00 ES IST SIEBEN UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:01 ES IST EINE MINUTE NACH SIEBEN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:02 ES IST ZWEI MINUTEN NACH SIEBEN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:03 ES IST DREI MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:04 ES IST VIER MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:05 ES IST FÜNF NACH SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:06 ES IST SECHS MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:07 ES IST SIEBEN MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:08 ES IST ACHT MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:09 ES IST NEUN MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:10 ES IST ZEHN NACH SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:11 ES IST ELF MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:12 ES IST ZWÖLF MINUTEN NACH SIEBEN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:13 ES IST DREI ZEHN MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:14 ES IST VIER ZEHN MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:15 ES IST VIERTEL NACH SIEBEN
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:16 ES IST SECH ZEHN MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:17 ES IST SIEB ZEHN MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:18 ES IST ACHT ZEHN MINUTEN NACH SIEBEN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:19 ES IST NEUN ZEHN MINUTEN NACH SIEBEN
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x1f80, 0x0000, 0x0000, 0x0000 },  // 07:20 ES IST ZWANZIG NACH SIEBEN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:21 ES IST NEUN MINUTEN VOR HALB ACHT
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:22 ES IST ACHT MINUTEN VOR HALB ACHT
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:23 ES IST SIEBEN MINUTEN VOR HALB ACHT
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:24 ES IST SECHS MINUTEN VOR HALB ACHT
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x01e0, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:25 ES IST FÜNF VOR HALB ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:26 ES IST VIER MINUTEN VOR HALB ACHT
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:27 ES IST DREI MINUTEN VOR HALB ACHT
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:28 ES IST ZWEI MINUTEN VOR HALB ACHT
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x01e0, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:29 ES IST EINE MINUTE VOR HALB ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:30 ES IST HALB ACHT
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01ef, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:31 ES IST EINE MINUTE NACH HALB ACHT
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:32 ES IST ZWEI MINUTEN NACH HALB ACHT
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:33 ES IST DREI MINUTEN NACH HALB ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:34 ES IST VIER MINUTEN NACH HALB ACHT
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x01ef, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:35 ES IST FÜNF NACH HALB ACHT
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:36 ES IST SECHS MINUTEN NACH HALB ACHT
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:37 ES IST SIEBEN MINUTEN NACH HALB ACHT
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:38 ES IST ACHT MINUTEN NACH HALB ACHT
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:39 ES IST NEUN MINUTEN NACH HALB ACHT
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:40 ES IST ZWANZIG VOR ACHT
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:41 ES IST NEUN ZEHN MINUTEN VOR ACHT
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:42 ES IST ACHT ZEHN MINUTEN VOR ACHT
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:43 ES IST SIEB ZEHN MINUTEN VOR ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:44 ES IST SECH ZEHN MINUTEN VOR ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:45 ES IST VIERTEL VOR ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:46 ES IST VIER ZEHN MINUTEN VOR ACHT
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:47 ES IST DREI ZEHN MINUTEN VOR ACHT
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:48 ES IST ZWÖLF MINUTEN VOR ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:49 ES IST ELF MINUTEN VOR ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:50 ES IST ZEHN VOR ACHT
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:51 ES IST NEUN MINUTEN VOR ACHT
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:52 ES IST ACHT MINUTEN VOR ACHT
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:53 ES IST SIEBEN MINUTEN VOR ACHT
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:54 ES IST SECHS MINUTEN VOR ACHT
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:55 ES IST FÜNF VOR ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:56 ES IST VIER MINUTEN VOR ACHT
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:57 ES IST DREI MINUTEN VOR ACHT
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:58 ES IST ZWEI MINUTEN VOR ACHT
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 07:59 ES IST EINE MINUTE VOR ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0f00, 0x1c00 },  // 08:00 ES IST ACHT UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:01 ES IST EINE MINUTE NACH ACHT
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:02 ES IST ZWEI MINUTEN NACH ACHT
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:03 ES IST DREI MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:04 ES IST VIER MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:05 ES IST FÜNF NACH ACHT
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:06 ES IST SECHS MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:07 ES IST SIEBEN MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:08 ES IST ACHT MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:09 ES IST NEUN MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:10 ES IST ZEHN NACH ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:11 ES IST ELF MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:12 ES IST ZWÖLF MINUTEN NACH ACHT
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:13 ES IST DREI ZEHN MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:14 ES IST VIER ZEHN MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:15 ES IST VIERTEL NACH ACHT
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:16 ES IST SECH ZEHN MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:17 ES IST SIEB ZEHN MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:18 ES IST ACHT ZEHN MINUTEN NACH ACHT
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:19 ES IST NEUN ZEHN MINUTEN NACH ACHT
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x0f00, 0x0000 },  // 08:20 ES IST ZWANZIG NACH ACHT
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:21 ES IST NEUN MINUTEN VOR HALB NEUN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:22 ES IST ACHT MINUTEN VOR HALB NEUN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:23 ES IST SIEBEN MINUTEN VOR HALB NEUN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:24 ES IST SECHS MINUTEN VOR HALB NEUN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x01e0, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:25 ES IST FÜNF VOR HALB NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:26 ES IST VIER MINUTEN VOR HALB NEUN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:27 ES IST DREI MINUTEN VOR HALB NEUN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:28 ES IST ZWEI MINUTEN VOR HALB NEUN
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x01e0, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:29 ES IST EINE MINUTE VOR HALB NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:30 ES IST HALB NEUN
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01ef, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:31 ES IST EINE MINUTE NACH HALB NEUN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:32 ES IST ZWEI MINUTEN NACH HALB NEUN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:33 ES IST DREI MINUTEN NACH HALB NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:34 ES IST VIER MINUTEN NACH HALB NEUN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x01ef, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:35 ES IST FÜNF NACH HALB NEUN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:36 ES IST SECHS MINUTEN NACH HALB NEUN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:37 ES IST SIEBEN MINUTEN NACH HALB NEUN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:38 ES IST ACHT MINUTEN NACH HALB NEUN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:39 ES IST NEUN MINUTEN NACH HALB NEUN
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:40 ES IST ZWANZIG VOR NEUN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:41 ES IST NEUN ZEHN MINUTEN VOR NEUN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:42 ES IST ACHT ZEHN MINUTEN VOR NEUN
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:43 ES IST SIEB ZEHN MINUTEN VOR NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:44 ES IST SECH ZEHN MINUTEN VOR NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:45 ES IST VIERTEL VOR NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:46 ES IST VIER ZEHN MINUTEN VOR NEUN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:47 ES IST DREI ZEHN MINUTEN VOR NEUN
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:48 ES IST ZWÖLF MINUTEN VOR NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:49 ES IST ELF MINUTEN VOR NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:50 ES IST ZEHN VOR NEUN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:51 ES IST NEUN MINUTEN VOR NEUN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:52 ES IST ACHT MINUTEN VOR NEUN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:53 ES IST SIEBEN MINUTEN VOR NEUN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:54 ES IST SECHS MINUTEN VOR NEUN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:55 ES IST FÜNF VOR NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:56 ES IST VIER MINUTEN VOR NEUN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:57 ES IST DREI MINUTEN VOR NEUN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:58 ES IST ZWEI MINUTEN VOR NEUN
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x0000, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 08:59 ES IST EINE MINUTE VOR NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00f0, 0x1c00 },  // 09:00 ES IST NEUN UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:01 ES IST EINE MINUTE NACH NEUN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:02 ES IST ZWEI MINUTEN NACH NEUN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:03 ES IST DREI MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:04 ES IST VIER MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:05 ES IST FÜNF NACH NEUN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:06 ES IST SECHS MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:07 ES IST SIEBEN MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:08 ES IST ACHT MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:09 ES IST NEUN MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:10 ES IST ZEHN NACH NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:11 ES IST ELF MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:12 ES IST ZWÖLF MINUTEN NACH NEUN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:13 ES IST DREI ZEHN MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:14 ES IST VIER ZEHN MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:15 ES IST VIERTEL NACH NEUN
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:16 ES IST SECH ZEHN MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:17 ES IST SIEB ZEHN MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:18 ES IST ACHT ZEHN MINUTEN NACH NEUN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:19 ES IST NEUN ZEHN MINUTEN NACH NEUN
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x00f0, 0x0000 },  // 09:20 ES IST ZWANZIG NACH NEUN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:21 ES IST NEUN MINUTEN VOR HALB ZEHN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:22 ES IST ACHT MINUTEN VOR HALB ZEHN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:23 ES IST SIEBEN MINUTEN VOR HALB ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:24 ES IST SECHS MINUTEN VOR HALB ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x01e0, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:25 ES IST FÜNF VOR HALB ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:26 ES IST VIER MINUTEN VOR HALB ZEHN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:27 ES IST DREI MINUTEN VOR HALB ZEHN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:28 ES IST ZWEI MINUTEN VOR HALB ZEHN
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x01e0, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:29 ES IST EINE MINUTE VOR HALB ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e0, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:30 ES IST HALB ZEHN
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01ef, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:31 ES IST EINE MINUTE NACH HALB ZEHN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:32 ES IST ZWEI MINUTEN NACH HALB ZEHN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:33 ES IST DREI MINUTEN NACH HALB ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:34 ES IST VIER MINUTEN NACH HALB ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x01ef, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:35 ES IST FÜNF NACH HALB ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:36 ES IST SECHS MINUTEN NACH HALB ZEHN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:37 ES IST SIEBEN MINUTEN NACH HALB ZEHN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:38 ES IST ACHT MINUTEN NACH HALB ZEHN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:39 ES IST NEUN MINUTEN NACH HALB ZEHN
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:40 ES IST ZWANZIG VOR ZEHN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:41 ES IST NEUN ZEHN MINUTEN VOR ZEHN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:42 ES IST ACHT ZEHN MINUTEN VOR ZEHN
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:43 ES IST SIEB ZEHN MINUTEN VOR ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:44 ES IST SECH ZEHN MINUTEN VOR ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:45 ES IST VIERTEL VOR ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:46 ES IST VIER ZEHN MINUTEN VOR ZEHN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:47 ES IST DREI ZEHN MINUTEN VOR ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:48 ES IST ZWÖLF MINUTEN VOR ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:49 ES IST ELF MINUTEN VOR ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:50 ES IST ZEHN VOR ZEHN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:51 ES IST NEUN MINUTEN VOR ZEHN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:52 ES IST ACHT MINUTEN VOR ZEHN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:53 ES IST SIEBEN MINUTEN VOR ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:54 ES IST SECHS MINUTEN VOR ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:55 ES IST FÜNF VOR ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:56 ES IST VIER MINUTEN VOR ZEHN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:57 ES IST DREI MINUTEN VOR ZEHN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:58 ES IST ZWEI MINUTEN VOR ZEHN
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x0000, 0x0000, 0x0000, 0x001e, 0x0000 },  // 09:59 ES IST EINE MINUTE VOR ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001e, 0x1c00 },  // 10:00 ES IST ZEHN UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:01 ES IST EINE MINUTE NACH ZEHN
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:02 ES IST ZWEI MINUTEN NACH ZEHN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:03 ES IST DREI MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:04 ES IST VIER MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:05 ES IST FÜNF NACH ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:06 ES IST SECHS MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:07 ES IST SIEBEN MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:08 ES IST ACHT MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:09 ES IST NEUN MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:10 ES IST ZEHN NACH ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:11 ES IST ELF MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:12 ES IST ZWÖLF MINUTEN NACH ZEHN
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:13 ES IST DREI ZEHN MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:14 ES IST VIER ZEHN MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:15 ES IST VIERTEL NACH ZEHN
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:16 ES IST SECH ZEHN MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:17 ES IST SIEB ZEHN MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:18 ES IST ACHT ZEHN MINUTEN NACH ZEHN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:19 ES IST NEUN ZEHN MINUTEN NACH ZEHN
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x001e, 0x0000 },  // 10:20 ES IST ZWANZIG NACH ZEHN
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x1de0, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:21 ES IST NEUN MINUTEN VOR HALB ELF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x1de0, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:22 ES IST ACHT MINUTEN VOR HALB ELF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x1de0, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:23 ES IST SIEBEN MINUTEN VOR HALB ELF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x1de0, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:24 ES IST SECHS MINUTEN VOR HALB ELF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x1de0, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:25 ES IST FÜNF VOR HALB ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x1de0, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:26 ES IST VIER MINUTEN VOR HALB ELF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x1de0, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:27 ES IST DREI MINUTEN VOR HALB ELF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x1de0, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:28 ES IST ZWEI MINUTEN VOR HALB ELF
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x1de0, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:29 ES IST EINE MINUTE VOR HALB ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1de0, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:30 ES IST HALB ELF
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x1def, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:31 ES IST EINE MINUTE NACH HALB ELF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x1def, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:32 ES IST ZWEI MINUTEN NACH HALB ELF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x1def, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:33 ES IST DREI MINUTEN NACH HALB ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x1def, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:34 ES IST VIER MINUTEN NACH HALB ELF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x1def, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:35 ES IST FÜNF NACH HALB ELF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x1def, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:36 ES IST SECHS MINUTEN NACH HALB ELF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x1def, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:37 ES IST SIEBEN MINUTEN NACH HALB ELF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x1def, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:38 ES IST ACHT MINUTEN NACH HALB ELF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x1def, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:39 ES IST NEUN MINUTEN NACH HALB ELF
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:40 ES IST ZWANZIG VOR ELF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:41 ES IST NEUN ZEHN MINUTEN VOR ELF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:42 ES IST ACHT ZEHN MINUTEN VOR ELF
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:43 ES IST SIEB ZEHN MINUTEN VOR ELF
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:44 ES IST SECH ZEHN MINUTEN VOR ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:45 ES IST VIERTEL VOR ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:46 ES IST VIER ZEHN MINUTEN VOR ELF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:47 ES IST DREI ZEHN MINUTEN VOR ELF
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:48 ES IST ZWÖLF MINUTEN VOR ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:49 ES IST ELF MINUTEN VOR ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:50 ES IST ZEHN VOR ELF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:51 ES IST NEUN MINUTEN VOR ELF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:52 ES IST ACHT MINUTEN VOR ELF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:53 ES IST SIEBEN MINUTEN VOR ELF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:54 ES IST SECHS MINUTEN VOR ELF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:55 ES IST FÜNF VOR ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:56 ES IST VIER MINUTEN VOR ELF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:57 ES IST DREI MINUTEN VOR ELF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:58 ES IST ZWEI MINUTEN VOR ELF
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x1c00, 0x0000, 0x0000, 0x0000, 0x0000 },  // 10:59 ES IST EINE MINUTE VOR ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c00, 0x0000, 0x0000, 0x0000, 0x1c00 },  // 11:00 ES IST ELF UHR
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:01 ES IST EINE MINUTE NACH ELF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:02 ES IST ZWEI MINUTEN NACH ELF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:03 ES IST DREI MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:04 ES IST VIER MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:05 ES IST FÜNF NACH ELF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:06 ES IST SECHS MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:07 ES IST SIEBEN MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:08 ES IST ACHT MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:09 ES IST NEUN MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0000, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:10 ES IST ZEHN NACH ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:11 ES IST ELF MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:12 ES IST ZWÖLF MINUTEN NACH ELF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:13 ES IST DREI ZEHN MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:14 ES IST VIER ZEHN MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0000, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:15 ES IST VIERTEL NACH ELF
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:16 ES IST SECH ZEHN MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:17 ES IST SIEB ZEHN MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:18 ES IST ACHT ZEHN MINUTEN NACH ELF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x00fe, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:19 ES IST NEUN ZEHN MINUTEN NACH ELF
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c0f, 0x0000, 0x0000, 0x0000, 0x0000 },  // 11:20 ES IST ZWANZIG NACH ELF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:21 ES IST NEUN MINUTEN VOR HALB ZWÖLF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:22 ES IST ACHT MINUTEN VOR HALB ZWÖLF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:23 ES IST SIEBEN MINUTEN VOR HALB ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:24 ES IST SECHS MINUTEN VOR HALB ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x01e0, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:25 ES IST FÜNF VOR HALB ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:26 ES IST VIER MINUTEN VOR HALB ZWÖLF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:27 ES IST DREI MINUTEN VOR HALB ZWÖLF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x01e0, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:28 ES IST ZWEI MINUTEN VOR HALB ZWÖLF
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x01e0, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:29 ES IST EINE MINUTE VOR HALB ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:30 ES IST HALB ZWÖLF
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01ef, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:31 ES IST EINE MINUTE NACH HALB ZWÖLF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:32 ES IST ZWEI MINUTEN NACH HALB ZWÖLF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:33 ES IST DREI MINUTEN NACH HALB ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:34 ES IST VIER MINUTEN NACH HALB ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0000, 0x01ef, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:35 ES IST FÜNF NACH HALB ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:36 ES IST SECHS MINUTEN NACH HALB ZWÖLF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:37 ES IST SIEBEN MINUTEN NACH HALB ZWÖLF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:38 ES IST ACHT MINUTEN NACH HALB ZWÖLF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x00fe, 0x01ef, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:39 ES IST NEUN MINUTEN NACH HALB ZWÖLF
+    { 0x003b, 0x007f, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:40 ES IST ZWANZIG VOR ZWÖLF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:41 ES IST NEUN ZEHN MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:42 ES IST ACHT ZEHN MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x000f, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:43 ES IST SIEB ZEHN MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0f00, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:44 ES IST SECH ZEHN MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x007f, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:45 ES IST VIERTEL VOR ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e0f, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:46 ES IST VIER ZEHN MINUTEN VOR ZWÖLF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:47 ES IST DREI ZEHN MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x001f, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:48 ES IST ZWÖLF MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:49 ES IST ELF MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x1e00, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:50 ES IST ZEHN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x01e0, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:51 ES IST NEUN MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x1e00, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:52 ES IST ACHT MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x003f, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:53 ES IST SIEBEN MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x1f00, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:54 ES IST SECHS MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x00f0, 0x0000, 0x0e00, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:55 ES IST FÜNF VOR ZWÖLF
+    { 0x003b, 0x0000, 0x0000, 0x0000, 0x000f, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:56 ES IST VIER MINUTEN VOR ZWÖLF
+    { 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:57 ES IST DREI MINUTEN VOR ZWÖLF
+    { 0x003b, 0x0780, 0x0000, 0x0000, 0x0000, 0x0efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:58 ES IST ZWEI MINUTEN VOR ZWÖLF
+    { 0x1e3b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e7e, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f0 },  // 11:59 ES IST EINE MINUTE VOR ZWÖLF
+};
+
+}  // namespace LetterLayout
+
+#endif  // __LETTERLAYOUT_13X11_DE_H
@@ -0,0 +1,187 @@
+#include "Log.h"
+
+
+Log::Record                Log::ring_[QUEUE_SIZE];
+std::atomic<uint32_t>      Log::write_pos_(0);
+std::atomic<uint32_t>      Log::read_pos_(0);
+std::atomic<uint32_t>      Log::dropped_(0);
+uint32_t                   Log::dropped_reported_ = 0;
+TaskHandle_t               Log::drain_task_ = NULL;
+
+static_assert((Log::QUEUE_SIZE & (Log::QUEUE_SIZE - 1)) == 0, "the size of the log ring must be a power of 2");
+
+
+void Log::setDrainTask(TaskHandle_t task)
+{
+    drain_task_ = task;
+}
+
+uint16_t Log::drain(Sink sink)
+{
+    uint16_t count = 0;
+
+    uint32_t dropped = dropped_.load();
+    if (dropped != dropped_reported_)
+    {
+        char line[48];
+        snprintf(line, sizeof(line), "%u log message(s) dropped", (unsigned int) (dropped - dropped_reported_));
+        dropped_reported_ = dropped;
+        sink(LOG_LEVEL_WARNING, millis(), line);
+    }
+
+    while (true)
+    {
+        uint32_t pos    = read_pos_.load(std::memory_order_relaxed);
+        Record*  record = &ring_[pos % QUEUE_SIZE];
+        if (record->sequence.load(std::memory_order_acquire) != lap(pos) + 1)
+            break;  // empty, or the producer has not finished the record yet
+
+        char line[LINE_SIZE];
+        format(record, line, sizeof(line));
+        uint8_t  level   = record->level;
+        uint32_t time_ms = record->time_ms;
+
+        // hand the slot back before the (possibly slow) output
+        record->sequence.store(lap(pos) + QUEUE_SIZE, std::memory_order_release);
+        read_pos_.store(pos + 1, std::memory_order_relaxed);
+
+        sink(level, time_ms, line);
+        count++;
+    }
+    return count;
+}
+
+uint32_t Log::getDropped()
+{
+    return dropped_.load();
+}
+
+// ----- private methods -----
+
+
+Log::Record* Log::claim(uint32_t *pos)
+{
+    // Bounded multi-producer queue after D. Vyukov: the slot of position p is free for writing it when its sequence
+    // is lap(p), holds the record of p at lap(p) + 1, and is free for p + QUEUE_SIZE once drained (the sequences
+    // count from the first position of the slot's lap, so the zero initialized ring is empty). Producers compete
+    // for a position with a single compare and swap, nobody ever waits for a lock.
+    *pos = write_pos_.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Record*  record   = &ring_[*pos % QUEUE_SIZE];
+        uint32_t sequence = record->sequence.load(std::memory_order_acquire);
+        int32_t  diff     = (int32_t) (sequence - lap(*pos));
+        if (diff == 0)
+        {
+            if (write_pos_.compare_exchange_weak(*pos, *pos + 1, std::memory_order_relaxed))
+                return record;
+        }
+        else if (diff < 0)
+        {
+            dropped_++;  // full
+            return NULL;
+        }
+        else
+        {
+            *pos = write_pos_.load(std::memory_order_relaxed);  // taken by another producer meanwhile
+        }
+    }
+}
+
+void Log::publish(Record* record, uint32_t pos)
+{
+    record->sequence.store(lap(pos) + 1, std::memory_order_release);
+
+    // only the first record in an empty ring wakes the drain task, it takes all of them at once anyway
+    if (pos == read_pos_.load(std::memory_order_relaxed) && drain_task_ != NULL)
+        xTaskNotifyGive(drain_task_);
+}
+
+void Log::put(Record* record, const char* text)
+{
+    // copied, so the string may be gone before the record is drained; truncated when the record is full
+    if (text == NULL)
+        text = "(null)";
+    uint8_t offset = record->text_len;
+    uint8_t len    = strnlen(text, TEXT_SIZE);
+    if (offset + len >= TEXT_SIZE)
+        len = (offset < TEXT_SIZE) ? TEXT_SIZE - 1 - offset : 0;
+    if (offset < TEXT_SIZE)
+    {
+        memcpy(record->text + offset, text, len);
+        record->text[offset + len] = '\0';
+        record->text_len = offset + len + 1;
+    }
+    else
+    {
+        offset = TEXT_SIZE - 1;  // the terminator of the last string
+    }
+    record->args[record->argc++] = offset;
+}
+
+uint16_t Log::format(const Record* record, char* line, uint16_t size)
+{
+    // printf with the stored arguments: the format is copied as is, every conversion goes through snprintf() on
+    // its own, with the argument converted to the type its length modifier asks for
+    uint16_t len = 0;
+    uint8_t  arg = 0;
+    const char* p = record->fmt;
+
+    auto append = [&](int written){
+        if (written > 0)
+            len = (len + written < size) ? len + written : size - 1;
+    };
+
+    line[0] = '\0';
+    while (len + 1 < size)
+    {
+        char c = pgm_read_byte(p++);
+        if (c == '\0')
+            break;
+        if (c != '%')
+        {
+            line[len++] = c;
+            line[len]   = '\0';
+            continue;
+        }
+
+        // flags, width, precision and length up to the conversion character
+        char    spec[16] = "%";
+        uint8_t n        = 1;
+        bool    is_long  = false;
+        do
+        {
+            c = pgm_read_byte(p++);
+            spec[n++] = c;
+            is_long |= (c == 'l');
+        } while (c != '\0' && strchr("diouxXcs%", c) == NULL && n < sizeof(spec) - 1);
+        spec[n] = '\0';
+        if (c == '\0')
+            break;
+
+        char*    out   = line + len;
+        uint16_t left  = size - len;
+        uint32_t value = (arg < record->argc) ? record->args[arg] : 0;
+        if (c == '%')
+        {
+            append(snprintf(out, left, "%%"));
+            continue;
+        }
+        if (arg >= record->argc)
+        {
+            append(snprintf(out, left, "%s", "(missing)"));
+            continue;
+        }
+        arg++;
+
+        if (c == 's')
+            append(snprintf(out, left, spec, record->text + value));
+        else if (c == 'd' || c == 'i')
+            append(is_long ? snprintf(out, left, spec, (long) (int32_t) value) : snprintf(out, left, spec, (int) value));
+        else if (c == 'c')
+            append(snprintf(out, left, spec, (int) value));
+        else
+            append(is_long ? snprintf(out, left, spec, (unsigned long) value) : snprintf(out, left, spec, (unsigned int) value));
+    }
+    return len;
+}
@@ -0,0 +1,150 @@
+#ifndef __LOG_H
+#define __LOG_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <type_traits>
+
+#include "configuration.h"
+
+// Asynchronous logging. A log call only copies the format pointer and its arguments into a slot of a lock-free
+// ring buffer (any task may log, nothing is formatted and nothing waits for the serial port or the network); the
+// drain task formats the records and hands them to the output. When the ring is full, records are dropped and
+// counted instead of waiting.
+//
+// Arguments may be integers of up to 32 bits, enums, chars and strings (%s, copied into the record, so temporaries
+// are fine). 64 bit values do not compile, they have to be cast (or scaled) first.
+// Formats must be literals, they are stored as pointers.
+
+#define LOG_LEVEL_ERROR    1
+#define LOG_LEVEL_WARNING  2
+#define LOG_LEVEL_INFO     3
+#define LOG_LEVEL_DEBUG    4
+
+#ifndef LOG_LEVEL
+    #define LOG_LEVEL  LOG_LEVEL_INFO
+#endif
+
+// messages above LOG_LEVEL are not compiled in at all
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+    #define LOG_ERROR(fmt, ...)    Log::write(LOG_LEVEL_ERROR,   PSTR(fmt), ##__VA_ARGS__)
+#else
+    #define LOG_ERROR(fmt, ...)    do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARNING
+    #define LOG_WARNING(fmt, ...)  Log::write(LOG_LEVEL_WARNING, PSTR(fmt), ##__VA_ARGS__)
+#else
+    #define LOG_WARNING(fmt, ...)  do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+    #define LOG_INFO(fmt, ...)     Log::write(LOG_LEVEL_INFO,    PSTR(fmt), ##__VA_ARGS__)
+#else
+    #define LOG_INFO(fmt, ...)     do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+    #define LOG_DEBUG(fmt, ...)    Log::write(LOG_LEVEL_DEBUG,   PSTR(fmt), ##__VA_ARGS__)
+#else
+    #define LOG_DEBUG(fmt, ...)    do {} while (0)
+#endif
+
+class Log
+{
+
+public:
+
+    static const uint8_t  QUEUE_SIZE = 32;   // records, a power of 2
+    static const uint8_t  MAX_ARGS   = 16;
+    static const uint8_t  TEXT_SIZE  = 64;   // bytes for the strings of a record
+    static const uint16_t LINE_SIZE  = 256;  // longest formatted message
+
+    // receives every formatted message, called by drain()
+    typedef void (*Sink)(uint8_t level, uint32_t time_ms, const char* text);
+
+    template<typename... Args> static void write(uint8_t level, const char* fmt, const Args&... args)
+    {
+        static_assert(sizeof...(Args) <= MAX_ARGS, "too many arguments for a log message");
+        uint32_t pos;
+        Record*  record = claim(&pos);
+        if (record == NULL)
+            return;
+        record->level    = level;
+        record->fmt      = fmt;
+        record->time_ms  = millis();
+        record->argc     = 0;
+        record->text_len = 0;
+        store(record, args...);
+        publish(record, pos);
+    }
+
+    // the task that runs drain(), it is notified when a record arrives in an empty ring
+    static void setDrainTask(TaskHandle_t task);
+
+    // formats all pending records and passes them to 'sink' (from one task only); returns their number
+    static uint16_t drain(Sink sink);
+
+    // records dropped so far because the ring was full
+    static uint32_t getDropped();
+
+private:
+
+    typedef struct {
+        std::atomic<uint32_t> sequence;  // state of the slot, see claim()
+        const char* fmt;
+        uint32_t    time_ms;
+        uint8_t     level;
+        uint8_t     argc;
+        uint8_t     text_len;
+        uint32_t    args[MAX_ARGS];      // integers, or offsets into text for strings
+        char        text[TEXT_SIZE];
+    } Record;
+
+    static Record                ring_[QUEUE_SIZE];
+    static std::atomic<uint32_t> write_pos_;
+    static std::atomic<uint32_t> read_pos_;
+    static std::atomic<uint32_t> dropped_;
+    static uint32_t              dropped_reported_;  // by drain()
+    static TaskHandle_t          drain_task_;
+
+    static uint32_t lap(uint32_t pos)
+    {
+        return pos & ~(uint32_t) (QUEUE_SIZE - 1);
+    }
+
+    static Record* claim(uint32_t *pos);
+    static void    publish(Record* record, uint32_t pos);
+
+    static void store(Record* record)
+    {
+    }
+
+    template<typename T, typename... Args> static void store(Record* record, const T& arg, const Args&... args)
+    {
+        put(record, arg);
+        store(record, args...);
+    }
+
+    template<typename T> static void put(Record* record, const T& value)
+    {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                      "log arguments must be integers or strings");
+        static_assert(sizeof(T) <= sizeof(uint32_t),
+                      "log arguments are stored in 32 bits, cast 64 bit values (or log them in parts)");
+        record->args[record->argc++] = (uint32_t) value;
+    }
+
+    static void put(Record* record, const char* text);
+    static void put(Record* record, char* text)
+    {
+        put(record, (const char*) text);
+    }
+
+    template<size_t N> static void put(Record* record, const char (&text)[N])
+    {
+        put(record, (const char*) text);
+    }
+
+    static uint16_t format(const Record* record, char* line, uint16_t size);
+
+};
+
+#endif  // __LOG_H
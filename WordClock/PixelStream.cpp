@@ -0,0 +1,156 @@
+#include "PixelStream.h"
+
+#include "LedMapping.h"
+
+
+PixelStream::PixelStream(uint16_t port, uint32_t timeout_ms) :
+  port_(port),
+  timeout_ms_(timeout_ms),
+  started_(false),
+  last_packet_ms_(0),
+  last_sequence_(0),
+  packets_(0),
+  dropped_(0),
+  lost_(0)
+{
+}
+
+void PixelStream::begin()
+{
+    this->started_ = (this->udp_.begin(this->port_) == 1);
+}
+
+bool PixelStream::next(Packet* packet)
+{
+    if (!this->started_)
+    {
+        return false;
+    }
+    while (true)
+    {
+        this->udp_.flush();  // what is left of the previous datagram
+        int size = this->udp_.parsePacket();
+        if (size <= 0)
+        {
+            return false;
+        }
+
+        uint8_t header[HEADER_SIZE + TIMECODE_SIZE];
+        if (size < HEADER_SIZE || this->udp_.read(header, HEADER_SIZE) != HEADER_SIZE)
+        {
+            this->dropped_++;
+            continue;
+        }
+        uint8_t flags       = header[0];
+        uint8_t type        = header[2];
+        uint8_t id          = header[3];
+        uint8_t header_size = (flags & FLAG_TIMECODE) ? HEADER_SIZE + TIMECODE_SIZE : HEADER_SIZE;
+        packet->offset      = ((uint32_t) header[4] << 24) | ((uint32_t) header[5] << 16) |
+                              ((uint32_t) header[6] << 8)  | header[7];
+        packet->length      = (header[8] << 8) | header[9];
+        packet->push        = (flags & FLAG_PUSH) != 0;
+
+        // only data for the display, in whole rgb pixels; no queries, replies or stored configurations
+        if ((flags & VERSION_MASK) != VERSION_1 || (flags & (FLAG_STORAGE | FLAG_REPLY | FLAG_QUERY)) != 0 ||
+            (type != TYPE_UNDEFINED && type != TYPE_RGB8) || id != ID_DISPLAY || packet->offset % 3 != 0 ||
+            size < header_size + packet->length)
+        {
+            this->dropped_++;
+            continue;
+        }
+        if (header_size > HEADER_SIZE)
+        {
+            this->udp_.read(&header[HEADER_SIZE], TIMECODE_SIZE);  // not used, frames are shown when they arrive
+        }
+
+        if (!isActive())
+        {
+            this->last_sequence_ = 0;  // a new stream, maybe from another sender
+        }
+        if (!acceptSequence(header[1] & SEQUENCE_MASK))
+        {
+            this->dropped_++;
+            continue;
+        }
+        this->last_packet_ms_ = millis();
+        this->packets_++;
+        return true;
+    }
+}
+
+void PixelStream::readPixels(const Packet& packet, FrameBuffer& frame)
+{
+    uint32_t first = packet.offset / 3;
+    uint32_t count = packet.length / 3;   // a trailing part of a pixel is ignored
+    if (first >= LED_CNT)
+    {
+        return;
+    }
+    if (count > LED_CNT - first)
+    {
+        count = LED_CNT - first;          // channels beyond the display are ignored
+    }
+
+    uint8_t chunk[CHUNK_PIXELS * 3];
+    for (uint32_t done = 0; done < count; )
+    {
+        uint32_t n = count - done;
+        if (n > CHUNK_PIXELS)
+        {
+            n = CHUNK_PIXELS;
+        }
+        if (this->udp_.read(chunk, n * 3) != (int) (n * 3))
+        {
+            return;
+        }
+        for (uint32_t i = 0; i < n; i++)
+        {
+            uint32_t pixel = first + done + i;
+            frame.setPixel(LedMapping::index(pixel % MATRIX_WIDTH, pixel / MATRIX_WIDTH),
+                           RgbColor(chunk[3 * i], chunk[3 * i + 1], chunk[3 * i + 2]));
+        }
+        done += n;
+    }
+}
+
+bool PixelStream::isActive() const
+{
+    return this->packets_ > 0 && millis() - this->last_packet_ms_ < this->timeout_ms_;
+}
+
+uint32_t PixelStream::getPackets() const
+{
+    return this->packets_;
+}
+
+uint32_t PixelStream::getDropped() const
+{
+    return this->dropped_;
+}
+
+uint32_t PixelStream::getLost() const
+{
+    return this->lost_;
+}
+
+// ----- private methods -----
+
+
+bool PixelStream::acceptSequence(uint8_t sequence)
+{
+    // the numbers run 1..15 and wrap to 1; up to 7 ahead of the last one is newer (the ones between were lost),
+    // more is taken as behind it
+    if (sequence == 0 || this->last_sequence_ == 0)
+    {
+        this->last_sequence_ = sequence;
+        return true;
+    }
+    uint8_t ahead = (sequence + 15 - this->last_sequence_) % 15;
+    if (ahead == 0 || ahead > 7)
+    {
+        return false;  // duplicate or late
+    }
+    this->lost_          += ahead - 1;
+    this->last_sequence_  = sequence;
+    return true;
+}
@@ -0,0 +1,85 @@
+#ifndef __PIXELSTREAM_H
+#define __PIXELSTREAM_H
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+#include "LedMatrix.h"
+
+// Realtime pixels from a light controller over UDP, in the Distributed Display Protocol (DDP, as sent by xLights,
+// WLED, ...), so the clock can be driven as a generic MATRIX_WIDTH x MATRIX_HEIGHT display. The channels of the
+// display are its pixels row by row from the top left, 3 bytes (red, green, blue) each, whatever the wiring.
+//
+// A packet carries the channels from its offset on, a whole frame or a part of one; the packet with the push flag
+// completes the frame. The pixels go from the datagram straight into the led buffer, mapped to the wiring on the
+// way, so a frame is never buffered as a whole. When the sender numbers its packets, duplicates and packets that
+// arrive after a newer one are dropped, their pixels would be older than those on the leds.
+//
+// Only the render task uses it (see LedMatrix::setPixelStream()). It polls the socket, which costs a few
+// microseconds when nothing arrived: often while a stream runs, rarely while the clock is shown.
+
+class PixelStream
+{
+
+public:
+
+    static const uint16_t DDP_PORT     = 4048;
+    static const uint32_t POLL_MS      = 1;    // while the stream runs
+    static const uint32_t IDLE_POLL_MS = 20;   // for the first packet of a stream
+
+    typedef struct {
+        uint32_t offset;   // first channel
+        uint16_t length;   // channels in the payload
+        bool     push;     // completes a frame
+    } Packet;
+
+    // the stream ends when no packet arrived for 'timeout_ms'
+    PixelStream(uint16_t port, uint32_t timeout_ms);
+
+    void begin();
+
+    // the next datagram that arrived, if it is a packet for the display; the others are dropped (and counted)
+    bool next(Packet* packet);
+
+    // writes the payload of the packet next() just returned into 'frame'
+    void readPixels(const Packet& packet, FrameBuffer& frame);
+
+    // a packet arrived within the timeout
+    bool isActive() const;
+
+    uint32_t getPackets() const;   // taken
+    uint32_t getDropped() const;   // invalid, not for the display, duplicated or late
+    uint32_t getLost() const;      // gaps in the sequence numbers
+
+private:
+
+    static const uint8_t  HEADER_SIZE     = 10;
+    static const uint8_t  TIMECODE_SIZE   = 4;       // after the header, with FLAG_TIMECODE
+    static const uint8_t  VERSION_MASK    = 0xC0;
+    static const uint8_t  VERSION_1       = 0x40;
+    static const uint8_t  FLAG_TIMECODE   = 0x10;
+    static const uint8_t  FLAG_STORAGE    = 0x08;
+    static const uint8_t  FLAG_REPLY      = 0x04;
+    static const uint8_t  FLAG_QUERY      = 0x02;
+    static const uint8_t  FLAG_PUSH       = 0x01;
+    static const uint8_t  SEQUENCE_MASK   = 0x0F;    // 1..15, 0 if the sender does not number its packets
+    static const uint8_t  TYPE_UNDEFINED  = 0x00;    // taken as rgb
+    static const uint8_t  TYPE_RGB8       = 0x0B;
+    static const uint8_t  ID_DISPLAY      = 1;       // the default output device
+    static const uint8_t  CHUNK_PIXELS    = 16;      // read from the socket at a time
+
+    uint16_t port_;
+    uint32_t timeout_ms_;
+    WiFiUDP  udp_;
+    bool     started_;
+    uint32_t last_packet_ms_;
+    uint8_t  last_sequence_;   // 0: none yet
+    uint32_t packets_;
+    uint32_t dropped_;
+    uint32_t lost_;
+
+    bool acceptSequence(uint8_t sequence);
+
+};
+
+#endif  // __PIXELSTREAM_H
@@ -0,0 +1,51 @@
+#ifndef __PRNG_H
+#define __PRNG_H
+
+#include <stdint.h>
+
+// Small, seedable pseudo random number generator (Marsaglia's xorshift32). Not for anything security related,
+// but cheap, reproducible for a given seed and independent of the global Arduino random() state.
+
+class Prng
+{
+
+public:
+
+    explicit Prng(uint32_t seed)
+    {
+        this->state_ = (seed != 0) ? seed : 0x2545F491;  // the all-zero state would never change
+    }
+
+    uint32_t next()
+    {
+        this->state_ ^= this->state_ << 13;
+        this->state_ ^= this->state_ >> 17;
+        this->state_ ^= this->state_ << 5;
+        return this->state_;
+    }
+
+    // uniform in 0..bound-1 (multiply and shift instead of modulo: no division, negligible bias for small bounds)
+    uint32_t below(uint32_t bound)
+    {
+        return ((uint64_t) next() * bound) >> 32;
+    }
+
+    // shuffles 'values' in place (Fisher-Yates)
+    template<typename T> void shuffle(T* values, uint32_t count)
+    {
+        for (uint32_t i = count; i > 1; i--)
+        {
+            uint32_t j = below(i);
+            T temp        = values[i - 1];
+            values[i - 1] = values[j];
+            values[j]     = temp;
+        }
+    }
+
+private:
+
+    uint32_t state_;
+
+};
+
+#endif  // __PRNG_H
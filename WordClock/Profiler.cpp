@@ -0,0 +1,88 @@
+#include "Profiler.h"
+
+#if PROFILING_ENABLED
+
+#include "assertions.h"
+
+
+Profiler::Histogram Profiler::histograms_[STAGE_COUNT];
+uint32_t            Profiler::missed_deadlines_ = 0;
+
+static const char* const STAGE_NAMES[Profiler::STAGE_COUNT] = {
+    "from_time",
+    "splash_random",
+    "splash_snake2",
+    "splash_user",
+    "trans_fade",
+    "trans_wipe",
+    "trans_typewriter",
+    "trans_dissolve",
+    "trans_user",
+    "compose",
+    "output",
+    "show",
+    "tick_to_frame"
+};
+
+
+void Profiler::snapshot(uint8_t stage, Histogram* histogram)
+{
+    ASSERT(stage < STAGE_COUNT);
+    memcpy(histogram, &histograms_[stage], sizeof(Histogram));
+}
+
+uint32_t Profiler::getMissedDeadlines()
+{
+    return missed_deadlines_;
+}
+
+void Profiler::reset()
+{
+    memset(histograms_, 0, sizeof(histograms_));
+    missed_deadlines_ = 0;
+}
+
+const char* Profiler::stageName(uint8_t stage)
+{
+    return (stage < STAGE_COUNT) ? STAGE_NAMES[stage] : "?";
+}
+
+uint32_t Profiler::percentile(const Histogram& histogram, uint8_t percent)
+{
+    uint64_t wanted = ((uint64_t) histogram.count * percent + 99) / 100;
+    uint64_t seen   = 0;
+    for (uint8_t b = 0; b < BUCKETS - 1; b++)
+    {
+        seen += histogram.buckets[b];
+        if (seen >= wanted)
+        {
+            uint32_t limit = (1UL << b) - 1;
+            return (limit < histogram.max_us) ? limit : histogram.max_us;
+        }
+    }
+    return histogram.max_us;  // in the open bucket
+}
+
+uint32_t Profiler::averageUs(const Histogram& histogram)
+{
+    return (histogram.count > 0) ? histogram.sum_cycles / CYCLES_PER_US / histogram.count : 0;
+}
+
+uint32_t Profiler::averageNs(const Histogram& histogram)
+{
+    return (histogram.count > 0) ? histogram.sum_cycles * 1000 / CYCLES_PER_US / histogram.count : 0;
+}
+
+int Profiler::formatJson(uint8_t stage, char* buffer, uint16_t size)
+{
+    Histogram h;
+    snapshot(stage, &h);
+    return snprintf(buffer, size,
+                    "{\"stage\":\"%s\",\"n\":%lu,\"avg\":%lu,\"p50\":%lu,\"p90\":%lu,\"p99\":%lu,\"max\":%lu}",
+                    stageName(stage), (unsigned long) h.count,
+                    (unsigned long) averageUs(h),
+                    (unsigned long) percentile(h, 50), (unsigned long) percentile(h, 90),
+                    (unsigned long) percentile(h, 99), (unsigned long) h.max_us);
+}
+
+#endif  // PROFILING_ENABLED
@@ -0,0 +1,131 @@
+#ifndef __PROFILER_H
+#define __PROFILER_H
+
+#include <Arduino.h>
+
+#include "configuration.h"
+
+// Latency histograms of the render path. A probe reads the cpu's cycle counter when its scope begins and ends
+// and sorts the difference into a power of 2 histogram of microseconds, so it costs a few dozen cycles and never
+// calls into the system. Besides the stages the probes measure, the frames that were rendered late are counted.
+//
+// Each core of the ESP32 has a cycle counter of its own, so a probe only measures right if its scope begins and
+// ends on the same core: the render task is pinned to one (LED_TASK_CORE, see WordClock.ino) and must stay so.
+//
+// Only the render task records. Snapshots may be taken from any task; they are plain copies of word sized
+// counters, so one may mix in a record or two from the next frame, which does not matter for statistics.
+//
+// With PROFILING_ENABLED false (configuration.h) the probes compile to nothing, and so does the profiler.
+
+#ifndef PROFILING_ENABLED
+    #define PROFILING_ENABLED  false
+#endif
+
+#if PROFILING_ENABLED
+    #define PROFILE_SCOPE(stage)         Profiler::Scope profile_scope_(stage)
+    #define PROFILE_RECORD(stage, us)    Profiler::record(stage, us)
+    #define PROFILE_MISSED_DEADLINE()    Profiler::missedDeadline()
+#else
+    #define PROFILE_SCOPE(stage)         do {} while (0)
+    #define PROFILE_RECORD(stage, us)    do {} while (0)
+    #define PROFILE_MISSED_DEADLINE()    do {} while (0)
+#endif
+
+#if PROFILING_ENABLED
+
+class Profiler
+{
+
+public:
+
+    typedef enum {
+        STAGE_FROM_TIME        = 0,  // WordFrame::fromTime()
+        STAGE_SPLASH_RANDOM    = 1,  // splash screens, in the order of LedMatrix::SPLASH_FUNCTIONS
+        STAGE_SPLASH_SNAKE2    = 2,
+        STAGE_SPLASH_USER      = 3,
+        STAGE_TRANS_FADE       = 4,  // time transition steps, in the order of LedMatrix::TRANSITION_FUNCTIONS
+        STAGE_TRANS_WIPE       = 5,
+        STAGE_TRANS_TYPEWRITER = 6,
+        STAGE_TRANS_DISSOLVE   = 7,
+        STAGE_TRANS_USER       = 8,
+        STAGE_COMPOSE          = 9,  // seconds drawn over the time
+        STAGE_OUTPUT           = 10, // the frame buffer through brightness and gamma into the bus
+        STAGE_SHOW             = 11, // Show(): the whole transfer when bit-banging, else starting it
+        STAGE_TICK_TO_FRAME    = 12, // from the beginning of a second to the first frame that shows it
+        STAGE_COUNT            = 13
+    } Stage;
+
+    static const uint8_t BUCKETS = 20;  // bucket 0: < 1 us, bucket b: 2^(b-1) .. 2^b - 1 us, the last one open
+
+    typedef struct {
+        uint32_t count;
+        uint32_t max_us;
+        uint64_t sum_cycles;  // not microseconds, the stages that take less than one would average to nothing
+        uint32_t buckets[BUCKETS];
+    } Histogram;
+
+    // measures the time until the end of the enclosing scope
+    class Scope
+    {
+    public:
+        Scope(uint8_t stage) : stage_(stage), start_(ESP.getCycleCount()) {}
+        ~Scope() { recordCycles(this->stage_, ESP.getCycleCount() - this->start_); }
+    private:
+        uint8_t  stage_;
+        uint32_t start_;
+    };
+
+    static void record(uint8_t stage, uint32_t us)
+    {
+        add(stage, us, (uint64_t) us * CYCLES_PER_US);
+    }
+
+    static void recordCycles(uint8_t stage, uint32_t cycles)
+    {
+        add(stage, cycles / CYCLES_PER_US, cycles);
+    }
+
+    // a frame was rendered more than one frame interval after it was due
+    static void missedDeadline()
+    {
+        missed_deadlines_++;
+    }
+
+    static void snapshot(uint8_t stage, Histogram* histogram);
+    static uint32_t getMissedDeadlines();
+    static void reset();
+
+    static const char* stageName(uint8_t stage);
+
+    // upper bound [us] of the 'percent' percentile, as far as the buckets tell
+    static uint32_t percentile(const Histogram& histogram, uint8_t percent);
+
+    static uint32_t averageUs(const Histogram& histogram);
+    static uint32_t averageNs(const Histogram& histogram);
+
+    // one line of json with the summary of a stage, e.g. for mqtt
+    static int formatJson(uint8_t stage, char* buffer, uint16_t size);
+
+private:
+
+    static const uint32_t CYCLES_PER_US = F_CPU / 1000000;
+
+    static Histogram histograms_[STAGE_COUNT];
+    static uint32_t  missed_deadlines_;
+
+    static void add(uint8_t stage, uint32_t us, uint64_t cycles)
+    {
+        Histogram& h = histograms_[stage];
+        h.count++;
+        h.sum_cycles += cycles;
+        if (us > h.max_us)
+            h.max_us = us;
+        uint8_t bucket = (us == 0) ? 0 : 32 - __builtin_clz(us);
+        h.buckets[(bucket < BUCKETS) ? bucket : BUCKETS - 1]++;
+    }
+
+};
+
+#endif  // PROFILING_ENABLED
+
+#endif  // __PROFILER_H
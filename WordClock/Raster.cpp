@@ -0,0 +1,46 @@
+#include "Raster.h"
+
+
+// sin() of the first quarter turn in 64 steps, Q15
+static const int16_t SINE_QUARTER[65] PROGMEM = {
+        0,   804,  1608,  2410,  3212,  4011,  4808,  5602,
+     6393,  7179,  7962,  8739,  9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+    32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767
+};
+
+int16_t Raster::sin(uint16_t angle)
+{
+    uint16_t quarter = angle >> 14;
+    uint16_t a       = angle & 0x3FFF;
+    if (quarter & 0x01)
+        a = 0x4000 - a;  // mirror the 2nd and 4th quarter
+
+    // linear interpolation between the table entries
+    uint8_t index = a >> 8;
+    int32_t lo    = (int16_t) pgm_read_word(&SINE_QUARTER[index]);
+    int32_t hi    = (index < 64) ? (int16_t) pgm_read_word(&SINE_QUARTER[index + 1]) : lo;
+    int16_t value = lo + (((hi - lo) * (a & 0xFF)) >> 8);
+
+    return (quarter & 0x02) ? -value : value;
+}
+
+int16_t Raster::cos(uint16_t angle)
+{
+    return sin(angle + 0x4000);
+}
+
+uint16_t Raster::angle(uint32_t part, uint32_t whole)
+{
+    return ((part % whole) << 16) / whole;  // whole must not exceed 65536
+}
+
+bool Raster::isOnBorder(int8_t x, int8_t y)
+{
+    return (x == 0) || (x == MATRIX_WIDTH - 1) || (y == 0) || (y == MATRIX_HEIGHT - 1);
+}
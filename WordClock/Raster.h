@@ -0,0 +1,81 @@
+#ifndef __RASTER_H
+#define __RASTER_H
+
+#include <Arduino.h>
+
+#include "configuration.h"
+
+// Integer 2D rasterization on the led matrix. No floating point at all: angles are binary angles
+// (65536 = full turn, 0 = 12 o'clock, clockwise), trigonometry comes from a lookup table and lines
+// are anti-aliased (Xiaolin Wu) in 16.16 fixed point. Everything is clipped to the matrix.
+//
+// Drawing functions call plot(x, y, coverage) for every touched pixel, with coverage in 0..256 (= 0.0..1.0).
+
+class Raster
+{
+
+public:
+
+    static const uint16_t COVERAGE_FULL = 256;
+
+    // sine and cosine of a binary angle as Q15 (-32767..32767)
+    static int16_t sin(uint16_t angle);
+    static int16_t cos(uint16_t angle);
+
+    // binary angle of the fraction 'part / whole' of a full turn (e.g. milliseconds of a minute, whole <= 65536)
+    static uint16_t angle(uint32_t part, uint32_t whole);
+
+    static bool isOnBorder(int8_t x, int8_t y);
+
+    // anti-aliased line from the center of pixel (cx, cy) in direction 'angle' to the border of the matrix,
+    // without the start pixel itself
+    template<typename Plot> static void ray(int8_t cx, int8_t cy, uint16_t angle, Plot plot)
+    {
+        int32_t dx =  sin(angle);
+        int32_t dy = -cos(angle);
+        bool    steep = abs(dy) > abs(dx);  // walk along y
+        int32_t major = steep ? dy : dx;
+        int32_t minor = steep ? dx : dy;
+        int8_t  step  = (major < 0) ? -1 : 1;
+        int8_t  end   = (step < 0) ? -1 : (steep ? MATRIX_HEIGHT : MATRIX_WIDTH);
+
+        int32_t gradient = (minor << 16) / abs(major);                    // 16.16, |gradient| <= 1
+        int32_t intery   = ((int32_t) (steep ? cx : cy) << 16) + gradient;  // 16.16 minor coordinate
+
+        for (int8_t m = (steep ? cy : cx) + step; m != end; m += step, intery += gradient)
+        {
+            int8_t   lo   = intery >> 16;
+            uint16_t frac = (intery & 0xFFFF) >> 8;
+            if (steep)
+            {
+                plotClipped(lo,     m, COVERAGE_FULL - frac, plot);
+                plotClipped(lo + 1, m, frac,                 plot);
+            }
+            else
+            {
+                plotClipped(m, lo,     COVERAGE_FULL - frac, plot);
+                plotClipped(m, lo + 1, frac,                 plot);
+            }
+        }
+    }
+
+    // the anti-aliased dot where the ray() leaves the matrix, i.e. only its pixels on the outer ring
+    template<typename Plot> static void ringDot(int8_t cx, int8_t cy, uint16_t angle, Plot plot)
+    {
+        ray(cx, cy, angle, [&](int8_t x, int8_t y, uint16_t coverage){
+            if (isOnBorder(x, y))
+                plot(x, y, coverage);
+        });
+    }
+
+private:
+
+    template<typename Plot> static void plotClipped(int8_t x, int8_t y, uint16_t coverage, Plot& plot)
+    {
+        if ((x >= 0) && (x < MATRIX_WIDTH) && (y >= 0) && (y < MATRIX_HEIGHT))
+            plot(x, y, coverage);
+    }
+
+};
+
+#endif  // __RASTER_H
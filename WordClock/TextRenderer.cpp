@@ -0,0 +1,194 @@
+#include "TextRenderer.h"
+
+
+static const uint8_t GLYPHS_DIGITS_5X9[] PROGMEM = {
+    0x0E,   // .###.   0
+    0x11,   // #...#
+    0x11,   // #...#
+    0x11,   // #...#
+    0x11,   // #...#
+    0x11,   // #...#
+    0x11,   // #...#
+    0x11,   // #...#
+    0x0E,   // .###.
+
+    0x0C,   // ..##.   1
+    0x0A,   // .#.#.
+    0x09,   // #..#.
+    0x08,   // ...#.
+    0x08,   // ...#.
+    0x08,   // ...#.
+    0x08,   // ...#.
+    0x08,   // ...#.
+    0x08,   // ...#.
+
+    0x0E,   // .###.   2
+    0x11,   // #...#
+    0x10,   // ....#
+    0x10,   // ....#
+    0x0E,   // .###.
+    0x01,   // #....
+    0x01,   // #....
+    0x01,   // #....
+    0x1F,   // #####
+
+    0x0F,   // ####.   3
+    0x10,   // ....#
+    0x10,   // ....#
+    0x10,   // ....#
+    0x0E,   // .###.
+    0x10,   // ....#
+    0x10,   // ....#
+    0x10,   // ....#
+    0x0F,   // ####.
+
+    0x11,   // #...#   4
+    0x11,   // #...#
+    0x11,   // #...#
+    0x11,   // #...#
+    0x1E,   // .####
+    0x10,   // ....#
+    0x10,   // ....#
+    0x10,   // ....#
+    0x10,   // ....#
+
+    0x1F,   // #####   5
+    0x01,   // #....
+    0x01,   // #....
+    0x01,   // #....
+    0x0E,   // .###.
+    0x10,   // ....#
+    0x10,   // ....#
+    0x11,   // #...#
+    0x0E,   // .###.
+
+    0x0E,   // .###.   6
+    0x11,   // #...#
+    0x01,   // #....
+    0x01,   // #....
+    0x0F,   // ####.
+    0x11,   // #...#
+    0x11,   // #...#
+    0x11,   // #...#
+    0x0E,   // .###.
+
+    0x1F,   // #####   7
+    0x10,   // ....#
+    0x10,   // ....#
+    0x08,   // ...#.
+    0x08,   // ...#.
+    0x04,   // ..#..
+    0x04,   // ..#..
+    0x02,   // .#...
+    0x02,   // .#...
+
+    0x0E,   // .###.   8
+    0x11,   // #...#
+    0x11,   // #...#
+    0x11,   // #...#
+    0x0E,   // .###.
+    0x11,   // #...#
+    0x11,   // #...#
+    0x11,   // #...#
+    0x0E,   // .###.
+
+    0x0E,   // .###.   9
+    0x11,   // #...#
+    0x11,   // #...#
+    0x11,   // #...#
+    0x1E,   // .####
+    0x10,   // ....#
+    0x10,   // ....#
+    0x11,   // #...#
+    0x0E,   // .###.
+};
+
+// one glyph per line, rows from top to bottom
+static const uint8_t GLYPHS_3X5[] PROGMEM = {
+    0x0, 0x0, 0x7, 0x0, 0x0,   // '-'
+    0x0, 0x0, 0x0, 0x0, 0x2,   // '.'
+    0x4, 0x4, 0x2, 0x1, 0x1,   // '/'
+    0x7, 0x5, 0x5, 0x5, 0x7,   // '0'
+    0x2, 0x3, 0x2, 0x2, 0x7,   // '1'
+    0x7, 0x4, 0x7, 0x1, 0x7,   // '2'
+    0x7, 0x4, 0x6, 0x4, 0x7,   // '3'
+    0x5, 0x5, 0x7, 0x4, 0x4,   // '4'
+    0x7, 0x1, 0x7, 0x4, 0x7,   // '5'
+    0x7, 0x1, 0x7, 0x5, 0x7,   // '6'
+    0x7, 0x4, 0x2, 0x2, 0x2,   // '7'
+    0x7, 0x5, 0x7, 0x5, 0x7,   // '8'
+    0x7, 0x5, 0x7, 0x4, 0x7,   // '9'
+    0x0, 0x2, 0x0, 0x2, 0x0,   // ':'
+    0x0, 0x2, 0x0, 0x2, 0x1,   // ';'
+    0x4, 0x2, 0x1, 0x2, 0x4,   // '<'
+    0x0, 0x7, 0x0, 0x7, 0x0,   // '='
+    0x1, 0x2, 0x4, 0x2, 0x1,   // '>'
+    0x7, 0x4, 0x2, 0x0, 0x2,   // '?'
+    0x7, 0x5, 0x5, 0x1, 0x7,   // '@'
+    0x2, 0x5, 0x7, 0x5, 0x5,   // 'A'
+    0x3, 0x5, 0x3, 0x5, 0x3,   // 'B'
+    0x6, 0x1, 0x1, 0x1, 0x6,   // 'C'
+    0x3, 0x5, 0x5, 0x5, 0x3,   // 'D'
+    0x7, 0x1, 0x3, 0x1, 0x7,   // 'E'
+    0x7, 0x1, 0x3, 0x1, 0x1,   // 'F'
+    0x6, 0x1, 0x5, 0x5, 0x6,   // 'G'
+    0x5, 0x5, 0x7, 0x5, 0x5,   // 'H'
+    0x7, 0x2, 0x2, 0x2, 0x7,   // 'I'
+    0x4, 0x4, 0x4, 0x5, 0x2,   // 'J'
+    0x5, 0x5, 0x3, 0x5, 0x5,   // 'K'
+    0x1, 0x1, 0x1, 0x1, 0x7,   // 'L'
+    0x5, 0x7, 0x7, 0x5, 0x5,   // 'M'
+    0x3, 0x5, 0x5, 0x5, 0x5,   // 'N'
+    0x2, 0x5, 0x5, 0x5, 0x2,   // 'O'
+    0x3, 0x5, 0x3, 0x1, 0x1,   // 'P'
+    0x2, 0x5, 0x5, 0x3, 0x6,   // 'Q'
+    0x3, 0x5, 0x3, 0x5, 0x5,   // 'R'
+    0x6, 0x1, 0x2, 0x4, 0x3,   // 'S'
+    0x7, 0x2, 0x2, 0x2, 0x2,   // 'T'
+    0x5, 0x5, 0x5, 0x5, 0x7,   // 'U'
+    0x5, 0x5, 0x5, 0x5, 0x2,   // 'V'
+    0x5, 0x5, 0x7, 0x7, 0x5,   // 'W'
+    0x5, 0x5, 0x2, 0x5, 0x5,   // 'X'
+    0x5, 0x5, 0x2, 0x2, 0x2,   // 'Y'
+    0x7, 0x4, 0x2, 0x1, 0x7,   // 'Z'
+};
+
+const Font TextRenderer::FONT_DIGITS_5X9 = { 5, 9, '0', '9', GLYPHS_DIGITS_5X9 };
+const Font TextRenderer::FONT_3X5        = { 3, 5, '-', 'Z', GLYPHS_3X5        };
+
+
+int16_t TextRenderer::textWidth(const Font& font, const char* text, uint8_t spacing)
+{
+    size_t len = strlen(text);
+    return (len > 0) ? len * (font.width + spacing) - spacing : 0;
+}
+
+void TextRenderer::drawText(WordFrame& frame, const Font& font, const char* text, int16_t x, int8_t y,
+                            uint8_t spacing)
+{
+    for (const char* c = text; *c != '\0' && x < MATRIX_WIDTH; c++, x += font.width + spacing)
+    {
+        if (x + font.width > 0)
+        {
+            drawGlyph(frame, font, *c, x, y);
+        }
+    }
+}
+
+void TextRenderer::drawGlyph(WordFrame& frame, const Font& font, char c, int16_t x, int8_t y)
+{
+    if (c >= 'a' && c <= 'z' && font.last < 'a')
+        c -= 'a' - 'A';
+    if (c < font.first || c > font.last || x <= -font.width || x >= MATRIX_WIDTH)
+        return;  // unknown characters (and spaces) stay blank
+
+    const uint8_t* glyph = font.rows + (c - font.first) * font.height;
+    for (uint8_t row = 0; row < font.height; row++)
+    {
+        int8_t frame_y = y + row;
+        if (frame_y >= 0 && frame_y < MATRIX_HEIGHT)
+        {
+            frame.orBits(x, frame_y, pgm_read_byte(glyph + row));
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef __TEXTRENDERER_H
+#define __TEXTRENDERER_H
+
+#include <Arduino.h>
+
+#include "configuration.h"
+#include "WordFrame.h"
+
+// Monospaced bitmap font. The glyphs are stored in flash, one byte per row (bit x = column x, like the rows of a
+// BitFrame), so a glyph row can be blitted into a frame with a shift and OR.
+typedef struct
+{
+    uint8_t        width;   // glyph size, width <= 8
+    uint8_t        height;
+    char           first;   // characters covered by the font
+    char           last;
+    const uint8_t* rows;    // (last - first + 1) * height bytes
+} Font;
+
+class TextRenderer
+{
+
+public:
+
+    static const Font FONT_DIGITS_5X9;  // 0..9, fills the matrix with two digits
+    static const Font FONT_3X5;         // '-' .. 'Z' (lower case letters are drawn upper case), for status text
+
+    // width of 'text' in pixels, including the gaps between the glyphs
+    static int16_t textWidth(const Font& font, const char* text, uint8_t spacing = 1);
+
+    // sets the pixels of 'text' in 'frame' with the upper left corner at (x, y); everything outside of the matrix
+    // is clipped, so scrolling is just a matter of moving x
+    static void drawText(WordFrame& frame, const Font& font, const char* text, int16_t x, int8_t y,
+                         uint8_t spacing = 1);
+
+    static void drawGlyph(WordFrame& frame, const Font& font, char c, int16_t x, int8_t y);
+
+};
+
+#endif  // __TEXTRENDERER_H
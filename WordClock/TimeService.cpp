@@ -0,0 +1,337 @@
+#include "TimeService.h"
+
+#include <esp_timer.h>
+#if defined(ESP32)
+    #include <WiFi.h>
+#elif defined(ESP8266)
+    #include <ESP8266WiFi.h>
+#endif
+
+#include "assertions.h"
+#include "Log.h"
+
+
+static const uint8_t  NTP_PACKET_SIZE     = 48;
+static const uint64_t NTP_UNIX_OFFSET_SEC = 2208988800ULL;  // from 1900-01-01 (ntp) to 1970-01-01 (unix)
+
+
+TimeService::TimeService(const char* const* servers, uint8_t server_count, uint32_t interval_ms) :
+  servers_(servers),
+  server_count_(server_count),
+  server_(0),
+  server_resolved_(false),
+  interval_ms_(interval_ms),
+  state_(STATE_IDLE),
+  request_local_us_(0),
+  next_request_us_(0),
+  drift_base_us_(0),
+  failures_(0),
+  retry_ms_(RETRY_MIN_MS),
+  last_offset_us_(0),
+  mutex_(NULL)
+{
+    ASSERT(server_count > 0);
+    memset(&this->model_, 0, sizeof(this->model_));
+}
+
+void TimeService::begin()
+{
+    this->mutex_ = xSemaphoreCreateMutex();
+    this->udp_.begin(LOCAL_PORT);
+    this->next_request_us_ = esp_timer_get_time();
+}
+
+uint32_t TimeService::update()
+{
+    int64_t local_us = esp_timer_get_time();
+
+    if (this->state_ == STATE_WAITING)
+    {
+        if (!receiveReply(local_us))
+        {
+            if (local_us - this->request_local_us_ < TIMEOUT_MS * 1000LL)
+            {
+                return POLL_MS;
+            }
+            fail(local_us, "no reply");
+        }
+    }
+
+    if (local_us < this->next_request_us_)
+    {
+        return (this->next_request_us_ - local_us + 999) / 1000;
+    }
+    sendRequest(local_us);
+    return POLL_MS;
+}
+
+bool TimeService::now(struct timeval* tv) const
+{
+    Model m = model();
+    if (!m.synced)
+    {
+        return false;
+    }
+    int64_t utc_us = utc(m, esp_timer_get_time());
+    tv->tv_sec  = utc_us / 1000000;
+    tv->tv_usec = utc_us % 1000000;
+    return true;
+}
+
+bool TimeService::currentSecond(time_t* second, int64_t* begin_local_us, int64_t* end_local_us) const
+{
+    Model m = model();
+    if (!m.synced)
+    {
+        return false;
+    }
+    int64_t local_us = esp_timer_get_time();
+    int64_t utc_us   = utc(m, local_us);
+    *second         = utc_us / 1000000;
+    *begin_local_us = local(m, *second * 1000000LL, local_us);
+    *end_local_us   = local(m, (*second + 1) * 1000000LL, local_us);
+    return true;
+}
+
+bool TimeService::isSynced() const
+{
+    return model().synced;
+}
+
+int32_t TimeService::getDriftPpb() const
+{
+    return model().freq_ppb;
+}
+
+int32_t TimeService::getLastOffsetUs() const
+{
+    return this->last_offset_us_;
+}
+
+uint32_t TimeService::getFailures() const
+{
+    return this->failures_;
+}
+
+uint32_t TimeService::getRetryMs() const
+{
+    return this->retry_ms_;
+}
+
+// ----- private methods -----
+
+
+void TimeService::sendRequest(int64_t local_us)
+{
+    if (!this->server_resolved_)
+    {
+        // blocks (see TimeService.h); fail() moves on to the next server, which is looked up afresh
+        if (WiFi.hostByName(this->servers_[this->server_], this->server_address_) != 1)
+        {
+            fail(local_us, "dns lookup failed");
+            return;
+        }
+        this->server_resolved_ = true;
+        local_us = esp_timer_get_time();  // the lookup must not count into the round trip
+    }
+
+    // discard what is left of earlier requests, their replies would not match anyway
+    uint8_t packet[NTP_PACKET_SIZE];
+    while (this->udp_.parsePacket() > 0)
+    {
+        this->udp_.read(packet, sizeof(packet));
+    }
+
+    // sntp client request (rfc 4330); the transmit timestamp is the local time, the server echoes it as the
+    // originate timestamp, which tells its reply apart from late replies to earlier requests
+    memset(packet, 0, sizeof(packet));
+    packet[0] = (0 << 6) | (4 << 3) | 3;  // no leap second warning, version 4, client mode
+    write64(&packet[40], local_us);
+
+    this->request_local_us_ = local_us;
+    this->state_            = STATE_WAITING;
+    if (this->udp_.beginPacket(this->server_address_, NTP_PORT) != 1 ||
+        this->udp_.write(packet, sizeof(packet)) != sizeof(packet) || this->udp_.endPacket() != 1)
+    {
+        fail(local_us, "request not sent");
+    }
+}
+
+bool TimeService::receiveReply(int64_t local_us)
+{
+    uint8_t packet[NTP_PACKET_SIZE];
+    while (this->udp_.parsePacket() > 0)
+    {
+        if (this->udp_.read(packet, sizeof(packet)) != sizeof(packet))
+        {
+            continue;
+        }
+        uint8_t leap    = packet[0] >> 6;
+        uint8_t mode    = packet[0] & 0x07;
+        uint8_t stratum = packet[1];
+        if (mode != 4 || read64(&packet[24]) != (uint64_t) this->request_local_us_)
+        {
+            continue;  // not the reply to the current request
+        }
+        this->state_ = STATE_IDLE;
+        if (leap == 3 || stratum == 0 || stratum > 15)
+        {
+            fail(local_us, "server not synchronized");  // or a kiss-o'-death
+            return true;
+        }
+
+        // offset and round trip delay as in rfc 5905, with the clock's own idea of the send and receive times
+        Model   m  = model();
+        int64_t t1 = utc(m, this->request_local_us_);
+        int64_t t2 = toUnixUs(read64(&packet[32]));
+        int64_t t3 = toUnixUs(read64(&packet[40]));
+        int64_t t4 = utc(m, local_us);
+        int64_t delay_us = (t4 - t1) - (t3 - t2);
+        if (delay_us < 0 || delay_us > MAX_DELAY_US)
+        {
+            fail(local_us, "round trip too long");
+            return true;
+        }
+        applySample(local_us, ((t2 - t1) + (t3 - t4)) / 2, delay_us);
+        return true;
+    }
+    return false;
+}
+
+void TimeService::applySample(int64_t local_us, int64_t offset_us, int64_t delay_us)
+{
+    Model m = model();
+    int64_t now_utc = utc(m, local_us);
+
+    if (!m.synced || offset_us > STEP_THRESHOLD_US || offset_us < -STEP_THRESHOLD_US)
+    {
+        LOG_INFO("ntp: time set, offset %ld ms, delay %ld us", (int32_t) (offset_us / 1000), (int32_t) delay_us);
+        m.base_utc_us   = now_utc + offset_us;
+        m.slew_us       = 0;
+        m.synced        = true;
+        this->drift_base_us_ = local_us;  // the next sync measures the drift
+    }
+    else
+    {
+        // what the drift left since the last sync is the offset, less what was still to be slewed in
+        int64_t pending  = m.slew_us - slewApplied(m, local_us);
+        int64_t error    = offset_us - pending;
+        int64_t interval = local_us - this->drift_base_us_;
+        if (interval >= MIN_DRIFT_INTERVAL_MS * 1000LL)
+        {
+            int64_t error_ppb = error * 1000000000LL / interval;
+            if (error_ppb > MAX_DRIFT_PPB || error_ppb < -MAX_DRIFT_PPB)
+            {
+                LOG_WARNING("ntp: time jumped by %ld ms", (int32_t) (error / 1000));  // the server's, not ours
+            }
+            else
+            {
+                // the first estimate in full, then smoothed against the jitter of the samples
+                int64_t freq = m.freq_ppb + ((m.freq_ppb == 0) ? error_ppb : error_ppb / 4);
+                m.freq_ppb = (freq > MAX_DRIFT_PPB) ? MAX_DRIFT_PPB : (freq < -MAX_DRIFT_PPB) ? -MAX_DRIFT_PPB : freq;
+            }
+            this->drift_base_us_ = local_us;
+        }
+        LOG_INFO("ntp: offset %ld us, delay %ld us, drift %ld ppb", (int32_t) offset_us, (int32_t) delay_us,
+                 m.freq_ppb);
+        m.base_utc_us = now_utc;
+        m.slew_us     = offset_us;
+    }
+    m.base_local_us = local_us;
+    m.slew_start_us = local_us;
+    setModel(m);
+
+    this->last_offset_us_  = offset_us;
+    this->failures_        = 0;
+    this->retry_ms_        = RETRY_MIN_MS;
+    this->next_request_us_ = local_us + this->interval_ms_ * 1000LL;
+}
+
+void TimeService::fail(int64_t local_us, const char* reason)
+{
+    this->state_ = STATE_IDLE;
+    this->failures_++;
+    LOG_WARNING("ntp: %s: %s, retry in %lu s", this->servers_[this->server_], reason, this->retry_ms_ / 1000);
+
+    this->server_          = (this->server_ + 1) % this->server_count_;
+    this->server_resolved_ = false;
+    this->next_request_us_ = local_us + this->retry_ms_ * 1000LL;
+    uint32_t limit  = isSynced() ? RETRY_MAX_MS : RETRY_MAX_UNSYNCED_MS;
+    this->retry_ms_ = (this->retry_ms_ < limit / 2) ? this->retry_ms_ * 2 : limit;
+}
+
+TimeService::Model TimeService::model() const
+{
+    xSemaphoreTake(this->mutex_, portMAX_DELAY);
+    Model m = this->model_;
+    xSemaphoreGive(this->mutex_);
+    return m;
+}
+
+void TimeService::setModel(const Model& model)
+{
+    xSemaphoreTake(this->mutex_, portMAX_DELAY);
+    this->model_ = model;
+    xSemaphoreGive(this->mutex_);
+}
+
+int64_t TimeService::utc(const Model& model, int64_t local_us)
+{
+    int64_t elapsed = local_us - model.base_local_us;
+    return model.base_utc_us + elapsed + elapsed * model.freq_ppb / 1000000000LL + slewApplied(model, local_us);
+}
+
+int64_t TimeService::local(const Model& model, int64_t utc_us, int64_t near_local_us)
+{
+    // utc() runs at 1 +- (drift + slew rate), less than 1/1000 off: every step shrinks the distance by a factor
+    // of 1000 or more, so from a point within a second three get it down to the rounding of utc()
+    int64_t local_us = near_local_us;
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        local_us += utc_us - utc(model, local_us);
+    }
+    return local_us;
+}
+
+int64_t TimeService::slewApplied(const Model& model, int64_t local_us)
+{
+    // at most SLEW_PPM of the time since the start, so the clock never stands still or runs backwards
+    int64_t limit = (local_us - model.slew_start_us) * SLEW_PPM / 1000000;
+    if (model.slew_us >= 0)
+    {
+        return (model.slew_us < limit) ? model.slew_us : limit;
+    }
+    return (-model.slew_us < limit) ? model.slew_us : -limit;
+}
+
+uint64_t TimeService::read64(const uint8_t* data)
+{
+    uint64_t value = 0;
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+void TimeService::write64(uint8_t* data, uint64_t value)
+{
+    for (int8_t i = 7; i >= 0; i--, value >>= 8)
+    {
+        data[i] = value & 0xFF;
+    }
+}
+
+int64_t TimeService::toUnixUs(uint64_t ntp_timestamp)
+{
+    // 32 bits seconds, 32 bits fraction. The seconds wrap on 2036-02-07 (era 1); as rfc 4330 suggests, values
+    // below 2^31 are taken as era 1, so 1968 to 2104 come out right
+    uint64_t ntp_seconds = ntp_timestamp >> 32;
+    if (ntp_seconds < 0x80000000ULL)
+    {
+        ntp_seconds += 0x100000000ULL;
+    }
+    int64_t seconds  = ntp_seconds - NTP_UNIX_OFFSET_SEC;
+    int64_t fraction = ((ntp_timestamp & 0xFFFFFFFFULL) * 1000000) >> 32;
+    return seconds * 1000000 + fraction;
+}
@@ -0,0 +1,122 @@
+#ifndef __TIMESERVICE_H
+#define __TIMESERVICE_H
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include <sys/time.h>
+#include "freertos/semphr.h"
+
+// The wall clock, kept in sync with ntp servers in the background. update() runs in a task of its own and does not
+// wait for replies: it sends a request, returns, and picks up the reply (or notices the timeout) on one of the next
+// calls. So a slow or unreachable server does not delay the display, only the next sync. The one call that blocks
+// is the dns lookup of a server's name (up to a few seconds), and only when the service turns to a server: before
+// the first request to it and after every failure, i.e. once per backoff step. The address is kept until then.
+//
+// The time is a model on top of the free running microsecond counter (esp_timer_get_time()): the utc of a base
+// point plus the elapsed local time, corrected by the estimated drift of the local oscillator. Offsets found by
+// a sync are not stepped into the clock but slewed, i.e. spread over the following minutes at SLEW_PPM, so the
+// seconds keep ticking evenly and never repeat or skip. Only the first sync and offsets above STEP_THRESHOLD_US
+// set the clock directly. The drift is estimated from the offsets that are left after a sync interval.
+//
+// A reply is only seen at the next poll, and the time it waited counts into the round trip and half of it into
+// the offset. So the task polls every POLL_MS while a request is out: one sync costs a wakeup per millisecond of
+// round trip (some tens, at worst TIMEOUT_MS), once per sync interval, and keeps the offset within half a
+// millisecond of what the packet itself tells. Longer polls would save little and cost that precision.
+//
+// When a server does not answer, the next one is tried after RETRY_MIN_MS, and the wait doubles with every
+// failure up to RETRY_MAX_MS. Meanwhile the clock runs on with the last drift estimate.
+
+class TimeService
+{
+
+public:
+
+    static const uint16_t NTP_PORT              = 123;
+    static const uint16_t LOCAL_PORT            = 2390;
+    static const uint32_t POLL_MS               = 1;             // while waiting for a reply, see below
+    static const uint32_t TIMEOUT_MS            = 1000;          // for a reply
+    static const uint32_t RETRY_MIN_MS          = 4000;          // after the first failure
+    static const uint32_t RETRY_MAX_MS          = 3600000;       // backoff limit
+    static const uint32_t RETRY_MAX_UNSYNCED_MS = 64000;         // backoff limit as long as there is no time at all
+    static const int32_t  MAX_DELAY_US          = 500000;        // replies with a longer round trip are useless
+    static const int32_t  STEP_THRESHOLD_US     = 1000000;       // larger offsets are stepped, not slewed
+    static const int32_t  SLEW_PPM              = 500;           // rate at which offsets are corrected
+    static const int32_t  MAX_DRIFT_PPB         = 200000;        // of any sane crystal; beyond this an offset is a jump
+    static const uint32_t MIN_DRIFT_INTERVAL_MS = 60000;         // shorter intervals tell too little about the drift
+
+    // 'servers' must stay valid, they are tried in turn
+    TimeService(const char* const* servers, uint8_t server_count, uint32_t interval_ms);
+
+    void begin();
+
+    // does the next step of the sync (from the time task only); returns the time [ms] until it wants to run again
+    uint32_t update();
+
+    // the current utc; false (and nothing set) before the first sync
+    bool now(struct timeval* tv) const;
+
+    // The utc second running now and the local times [us, esp_timer_get_time()] at which it began and ends, so
+    // a renderer can take the phase within the second from the microsecond counter instead of polling for the
+    // next second. Exact to a microsecond, also while a correction is slewed in. False before the first sync.
+    bool currentSecond(time_t* second, int64_t* begin_local_us, int64_t* end_local_us) const;
+
+    bool     isSynced() const;
+    int32_t  getDriftPpb() const;      // estimated, positive if the local clock is slow
+    int32_t  getLastOffsetUs() const;  // found by the last sync
+    uint32_t getFailures() const;      // since the last successful sync
+    uint32_t getRetryMs() const;       // current backoff
+
+private:
+
+    typedef enum {
+        STATE_IDLE,
+        STATE_WAITING   // for a reply
+    } State;
+
+    typedef struct {
+        int64_t base_local_us;   // local time of the base point
+        int64_t base_utc_us;     // utc [us since 1970] at the base point
+        int32_t freq_ppb;        // drift correction
+        int64_t slew_start_us;   // local time the slew started
+        int32_t slew_us;         // offset to slew in from there
+        bool    synced;
+    } Model;
+
+    const char* const* servers_;
+    uint8_t            server_count_;
+    uint8_t            server_;             // the one in use
+    IPAddress          server_address_;
+    bool               server_resolved_;    // server_address_ is that of server_
+    uint32_t           interval_ms_;
+
+    WiFiUDP            udp_;
+    State              state_;
+    int64_t            request_local_us_;   // sent at, also the cookie in the request
+    int64_t            next_request_us_;    // local time
+    int64_t            drift_base_us_;      // local time of the sync the drift is measured from
+    uint32_t           failures_;
+    uint32_t           retry_ms_;
+    int32_t            last_offset_us_;
+
+    Model              model_;              // shared with the readers of the time
+    SemaphoreHandle_t  mutex_;
+
+    void sendRequest(int64_t local_us);
+    bool receiveReply(int64_t local_us);
+    void applySample(int64_t local_us, int64_t offset_us, int64_t delay_us);
+    void fail(int64_t local_us, const char* reason);
+
+    Model   model() const;
+    void    setModel(const Model& model);
+
+    static int64_t utc(const Model& model, int64_t local_us);
+    static int64_t local(const Model& model, int64_t utc_us, int64_t near_local_us);  // inverse of utc()
+    static int64_t slewApplied(const Model& model, int64_t local_us);
+
+    static uint64_t read64(const uint8_t* data);  // big endian, as in the packet
+    static void     write64(uint8_t* data, uint64_t value);
+    static int64_t  toUnixUs(uint64_t ntp_timestamp);
+
+};
+
+#endif  // __TIMESERVICE_H
@@ -0,0 +1,92 @@
+#ifndef __TRIPLEBUFFER_H
+#define __TRIPLEBUFFER_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "freertos/semphr.h"
+
+// Hands the latest version of a value from the tasks that change it to the one task that reads it. Of the three
+// buffers one belongs to the reader, one to the writers and the third holds the latest published version; both
+// sides only ever swap their buffer with that one, atomically. So the reader is wait-free: it never blocks, never
+// retries and never sees a half written value, however long it holds on to its buffer.
+//
+// Writers are serialized among each other by a mutex (priority inheritance, a spinning writer could starve the one
+// it waits for on a single core). They change a private copy of the latest value, so every writer may change some
+// fields without losing what the others changed.
+//
+// A value with a single writer task can skip both the mutex and the private copy: writeBuffer() and publish() let
+// that task fill the writers' buffer in place and swap it in. Such a buffer must not also be written by update().
+
+template<typename T> class TripleBuffer
+{
+
+public:
+
+    TripleBuffer(const T& initial)
+    {
+        for (uint8_t i = 0; i < 3; i++)
+            this->buffers_[i] = initial;
+        this->latest_ = initial;
+        this->shared_.store(1);
+        this->write_  = 2;
+        this->read_   = 0;
+        this->mutex_  = xSemaphoreCreateMutex();
+    }
+
+    // Calls func(T&) on the latest value and publishes the result if it returns true. Returns what func returned.
+    template<typename Func> bool update(Func func)
+    {
+        xSemaphoreTake(this->mutex_, portMAX_DELAY);
+        bool changed = func(this->latest_);
+        if (changed)
+        {
+            this->buffers_[this->write_] = this->latest_;
+            this->write_ = this->shared_.exchange(this->write_ | FRESH, std::memory_order_acq_rel) & INDEX;
+        }
+        xSemaphoreGive(this->mutex_);
+        return changed;
+    }
+
+    // For the single writer only (see above): its buffer, which holds some older version and has to be written
+    // completely, and then handed over to the reader by publish().
+    T& writeBuffer()
+    {
+        return this->buffers_[this->write_];
+    }
+
+    void publish()
+    {
+        this->write_ = this->shared_.exchange(this->write_ | FRESH, std::memory_order_acq_rel) & INDEX;
+    }
+
+    // The latest published value (for the reader task only). It stays valid and unchanged until the next call;
+    // 'fresh' tells whether it was published since the last call.
+    const T& read(bool* fresh = NULL)
+    {
+        bool is_fresh = (this->shared_.load(std::memory_order_relaxed) & FRESH) != 0;
+        if (is_fresh)
+        {
+            this->read_ = this->shared_.exchange(this->read_, std::memory_order_acq_rel) & INDEX;
+        }
+        if (fresh != NULL)
+        {
+            *fresh = is_fresh;
+        }
+        return this->buffers_[this->read_];
+    }
+
+private:
+
+    static const uint8_t INDEX = 0x03;
+    static const uint8_t FRESH = 0x04;  // set by a writer, cleared by the reader
+
+    T                    buffers_[3];
+    T                    latest_;   // the writers' working copy
+    std::atomic<uint8_t> shared_;   // index of the latest buffer | FRESH
+    uint8_t              write_;    // index of the writers' buffer
+    uint8_t              read_;     // index of the reader's buffer
+    SemaphoreHandle_t    mutex_;
+
+};
+
+#endif  // __TRIPLEBUFFER_H
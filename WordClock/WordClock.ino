@@ -13,13 +13,30 @@
 
 #include <WiFiUdp.h>
 #include <ArduinoOTA.h>
+#include <Preferences.h>
+#include <esp_timer.h>
 #include <time.h>
+#include <sys/time.h>
 
 #include "configuration.h"
+#include "EffectVm.h"
 #include "LedMatrix.h"
+#include "Log.h"
+#include "Profiler.h"
+#include "TimeService.h"
 
 #if MQTT_ENABLED
     #include <MQTT.h>  // "MQTT" by Joel Gaehwiler (v2.4.1) -- https://github.com/256dpi/arduino-mqtt
+
+    #include "CommandRouter.h"
+#endif
+
+#if MQTT_ENABLED && MQTT_MIRROR_ENABLED
+    #include "FrameMirror.h"
+#endif
+
+#if STREAM_ENABLED
+    #include "PixelStream.h"
 #endif
 
 
@@ -28,38 +45,90 @@
 
 uint32_t gProcessTimeMainLoop;
 uint32_t gProcessTimeTaskLoop;
+uint32_t gBusyTimeMainLoop;  // [us] accumulated time the main loop spent working instead of sleeping
+uint32_t gBusyTimeTaskLoop;  // [us] same for the led task
 
 time_t    previous_time = 0;
 
-time_t    last_sync_time;  // last time, system time was updated from ntp server
+const char* const NTP_SERVERS[] = { TIME_NTP_SERVER };
+const BaseType_t  LED_TASK_CORE = 1;  // the application core; the wifi stack runs on core 0
 
-LedMatrix led_matrix;
+LedMatrix   led_matrix;
+Preferences effect_store;  // the uploaded effects (see EffectVm.h) in the nvs, one key per kind
+TimeService time_service(NTP_SERVERS, sizeof(NTP_SERVERS) / sizeof(NTP_SERVERS[0]), TIME_SYNC_INTERVAL_SEC * 1000UL);
+
+#if STREAM_ENABLED
+    PixelStream pixel_stream(STREAM_PORT, STREAM_TIMEOUT_MS);
+#endif
 
 #if MQTT_ENABLED
     WiFiClient network;
-    MQTTClient mqttClient;
+#if MQTT_MIRROR_ENABLED
+    MQTTClient mqttClient(FrameMirror::MAX_MESSAGE_SIZE + 64);  // room for a keyframe and its topic
+    FrameMirror frame_mirror(MQTT_MIRROR_INTERVAL_MS, MQTT_MIRROR_KEYFRAME_SEC * 1000UL);
+#else
+    MQTTClient mqttClient(256);  // room for the STATS messages
+#endif
     TaskHandle_t taskmqtt;
+
+    // The log lines for mqtt, from the log task to the mqtt task: the client is not thread-safe, so only taskMQTT
+    // may use it. Lines that do not fit are dropped and counted, the log task never waits.
+    const UBaseType_t MQTT_LOG_QUEUE_SIZE = 8;
+    typedef struct {
+        char text[Log::LINE_SIZE];
+    } MqttLogLine;
+    QueueHandle_t         mqtt_log_queue = NULL;
+    std::atomic<uint32_t> mqtt_log_dropped(0);
 #endif
 
 // --------------------------------------------------
 
-#define LOG_PRINTFLN(fmt, ...)  printfln_P(PSTR(fmt), ##__VA_ARGS__)
-#define LOG_SIZE_MAX 256
-void printfln_P(const char *fmt, ...)
+// output of the log messages, called by the log task only (see Log.h)
+void logOutput(uint8_t level, uint32_t time_ms, const char* text)
 {
-    char buf[LOG_SIZE_MAX];
-    va_list ap;
-    va_start(ap, fmt);
-    vsnprintf_P(buf, LOG_SIZE_MAX, fmt, ap);
-    va_end(ap);
-    Serial.println(buf);
+    Serial.println(text);
 #if MQTT_ENABLED
-    mqttClient.publish("tele/" THIS_HOST_NAME "/LOG", buf);
+    MqttLogLine line;
+    strncpy(line.text, text, sizeof(line.text) - 1);
+    line.text[sizeof(line.text) - 1] = '\0';
+    if (xQueueSend(mqtt_log_queue, &line, 0) != pdTRUE)
+    {
+        mqtt_log_dropped++;
+    }
 #endif
 }
 
 // --------------------------------------------------
 
+// share of the time [1/100 %] a task was busy since the last call, from its accumulated busy time
+uint16_t dutyCycle(uint32_t busy_us, uint32_t *last_busy_us, uint32_t span_us)
+{
+    uint32_t busy = busy_us - *last_busy_us;
+    *last_busy_us = busy_us;
+    return (span_us > 0) ? (uint64_t) busy * 10000 / span_us : 0;
+}
+
+#if PROFILING_ENABLED
+// latency statistics of the render path since the start (see Profiler.h), through the log
+void logProfile()
+{
+    for (uint8_t stage = 0; stage < Profiler::STAGE_COUNT; stage++)
+    {
+        Profiler::Histogram h;
+        Profiler::snapshot(stage, &h);
+        if (h.count > 0)
+        {
+            LOG_INFO("profile %-16s n=%lu avg=%lu p50=%lu p90=%lu p99=%lu max=%lu us",
+                     Profiler::stageName(stage), h.count, Profiler::averageUs(h),
+                     Profiler::percentile(h, 50), Profiler::percentile(h, 90), Profiler::percentile(h, 99), h.max_us);
+        }
+    }
+    LOG_INFO("profile missed frame deadlines: %lu", Profiler::getMissedDeadlines());
+}
+#endif
+
+// --------------------------------------------------
+
 void initWiFi()
 {
     Serial.printf("Connecting to WiFi %s ", WIFI_SSID);
@@ -75,8 +144,8 @@ void initWiFi()
     if (timeout > 0)
     {
       Serial.println(" done");
-      LOG_PRINTFLN("Connected to WiFi");
-      LOG_PRINTFLN("IP address: %s", WiFi.localIP().toString().c_str());
+      LOG_INFO("Connected to WiFi");
+      LOG_INFO("IP address: %s", WiFi.localIP().toString().c_str());
     }
     else
     {
@@ -86,27 +155,6 @@ void initWiFi()
     }
 }
 
-void getNTPTime()
-{
-    // request time from ntp server
-    configTime(0, 0, TIME_NTP_SERVER);
-    setenv("TZ", TIME_POSIX_TIMEZONE_STR, 1);
-    tzset();
-
-    // check validity of local time
-    struct tm timeinfo;
-    if (getLocalTime(&timeinfo))
-    {
-      LOG_PRINTFLN("received ntp time");
-      time(&last_sync_time);
-    }
-    else
-    {
-      LOG_PRINTFLN("ERROR: Could not determine the time! Make sure the ntp server is accessible (check wifi and dns).");
-      // TODO: set led_matrix to error screen
-    }
-}
-
 void initOTA()
 {
     ArduinoOTA.setHostname(THIS_HOST_NAME);
@@ -133,27 +181,75 @@ void initOTA()
                 })
               .onError([](ota_error_t error)
                 {
-                    if (error == OTA_AUTH_ERROR)         LOG_PRINTFLN("OTAError[%u]: Auth Failed",    error);
-                    else if (error == OTA_BEGIN_ERROR)   LOG_PRINTFLN("OTAError[%u]: Begin Failed",   error);
-                    else if (error == OTA_CONNECT_ERROR) LOG_PRINTFLN("OTAError[%u]: Connect Failed", error);
-                    else if (error == OTA_RECEIVE_ERROR) LOG_PRINTFLN("OTAError[%u]: Receive Failed", error);
-                    else if (error == OTA_END_ERROR)     LOG_PRINTFLN("OTAError[%u]: End Failed",     error);
+                    if (error == OTA_AUTH_ERROR)         LOG_ERROR("OTAError[%u]: Auth Failed",    error);
+                    else if (error == OTA_BEGIN_ERROR)   LOG_ERROR("OTAError[%u]: Begin Failed",   error);
+                    else if (error == OTA_CONNECT_ERROR) LOG_ERROR("OTAError[%u]: Connect Failed", error);
+                    else if (error == OTA_RECEIVE_ERROR) LOG_ERROR("OTAError[%u]: Receive Failed", error);
+                    else if (error == OTA_END_ERROR)     LOG_ERROR("OTAError[%u]: End Failed",     error);
                 });
     ArduinoOTA.begin();
 }
 
 
+// the nvs keys of the uploaded effects, by EffectVm::Kind
+const char* const EFFECT_KEYS[3] = { NULL, "splash", "transition" };
+
+// the effects uploaded before the last restart, checked again (the firmware may have changed since); a stored splash
+// screen is the one of the start
+void loadEffects()
+{
+    if (!effect_store.begin("effects", true))
+    {
+        return;  // nothing was ever uploaded
+    }
+    for (uint8_t kind = EffectVm::KIND_SPLASH; kind <= EffectVm::KIND_TRANSITION; kind++)
+    {
+        uint8_t bytes[EffectVm::HEADER_SIZE + EffectVm::MAX_CODE];
+        size_t length = effect_store.getBytes(EFFECT_KEYS[kind], bytes, sizeof(bytes));
+        EffectVm::Program program;
+        if (length > 0 && EffectVm::load(bytes, length, &program) == NULL)
+        {
+            led_matrix.setEffect(program);
+            if (kind == EffectVm::KIND_SPLASH && program.duration_ms > 0)
+            {
+                led_matrix.setSplashScreen(2);
+            }
+        }
+    }
+    effect_store.end();
+}
+
+// keeps an uploaded effect for the next start; an empty one too, so a removed effect stays removed
+void storeEffect(uint8_t kind, const uint8_t* bytes, size_t length)
+{
+    effect_store.begin("effects", false);
+    effect_store.putBytes(EFFECT_KEYS[kind], bytes, length);
+    effect_store.end();
+}
+
+
 // the setup routine
 void setup()
 {
     Serial.begin(115200);
+    loadEffects();  // before the led task starts with the splash screen
+
+#if MQTT_ENABLED
+    mqtt_log_queue = xQueueCreate(MQTT_LOG_QUEUE_SIZE, sizeof(MqttLogLine));  // before the log task runs
+#endif
 
     //          Task function and name, Stack size in bytes, Input Parameters, Priority, Task handle.
-    xTaskCreate(taskLED, "LED Task", 10000, NULL, 2, NULL);
+    xTaskCreate(taskLog, "Log Task", 10000, NULL, 0, NULL);
+    // pinned: the profiler's probes read the cycle counter of the core they run on (see Profiler.h), and the
+    // frame timing does not depend on what the other core is busy with
+    xTaskCreatePinnedToCore(taskLED, "LED Task", 10000, NULL, 2, NULL, LED_TASK_CORE);
 
     initWiFi();
 
-    getNTPTime();
+    setenv("TZ", TIME_POSIX_TIMEZONE_STR, 1);  // for localtime(), the time service keeps utc
+    tzset();
+    time_service.begin();
+    xTaskCreate(taskTime, "Time Task", 10000, NULL, 1, NULL);
 
     xTaskCreate(taskOTA, "OTA Task", 10000, NULL, 1, NULL);
 
@@ -166,19 +262,33 @@ void setup()
 // the main loop
 void loop()
 {
-    uint32_t timeBeginLoop = millis();  // for main loop watchdog
+    uint32_t timeBeginLoop   = millis();  // for main loop watchdog
+    uint32_t timeBeginLoopUs = micros();
 
-    time_t now;
+    time_t  now;
+    int64_t second_begin_us;  // local time [us, esp_timer_get_time()] at which the second began
+#if !TIME_SIMULATION
+    int64_t second_end_us;
+#endif
 
 #if TIME_SIMULATION
     delay(1000 / TIME_SIMULATION_FACTOR);
-    now = previous_time + 1;
+    now             = previous_time + 1;
+    second_begin_us = esp_timer_get_time();
 #else
-    time(&now);  // get system time (seconds since 1970-01-01)
-
-    if (now - last_sync_time > TIME_SYNC_INTERVAL_SEC)
+    if (!time_service.currentSecond(&now, &second_begin_us, &second_end_us))
     {
-        getNTPTime();
+        // no time before the first sync; say so when the servers keep failing
+        static uint32_t reported_failures = 0;
+        uint32_t failures = time_service.getFailures();
+        if (failures >= 3 && failures != reported_failures)
+        {
+            reported_failures = failures;
+            LOG_ERROR("ERROR: Could not determine the time! Make sure the ntp server is accessible (check wifi and dns).");
+            led_matrix.showText("NTP ERROR");
+        }
+        delay(100);
+        return;
     }
 #endif
 
@@ -191,35 +301,102 @@ void loop()
         // only print on minute changes
         if (timeinfo->tm_sec == 0)
         {
-            LOG_PRINTFLN("%4d-%02d-%02d %02d:%02d:%02d   dst=%d   looptime=%lu ms",
-                       timeinfo->tm_year+1900, timeinfo->tm_mon+1, timeinfo->tm_mday,
-                       timeinfo->tm_hour, timeinfo->tm_min, timeinfo->tm_sec, timeinfo->tm_isdst,
-                       gProcessTimeTaskLoop);
+            static uint32_t last_log_us    = 0;
+            static uint32_t last_busy_main = 0;
+            static uint32_t last_busy_task = 0;
+            uint32_t span_us   = micros() - last_log_us;
+            uint16_t duty_main = dutyCycle(gBusyTimeMainLoop, &last_busy_main, span_us);
+            uint16_t duty_task = dutyCycle(gBusyTimeTaskLoop, &last_busy_task, span_us);
+            last_log_us += span_us;
+
+            LOG_INFO("%4d-%02d-%02d %02d:%02d:%02d   dst=%d   looptime=%lu ms   frames sent/skipped=%lu/%lu"
+                         "   cpu main/led=%u.%02u/%u.%02u %%",
+                     timeinfo->tm_year+1900, timeinfo->tm_mon+1, timeinfo->tm_mday,
+                     timeinfo->tm_hour, timeinfo->tm_min, timeinfo->tm_sec, timeinfo->tm_isdst,
+                     gProcessTimeTaskLoop, led_matrix.getFramesPushed(), led_matrix.getFramesSkipped(),
+                     duty_main / 100, duty_main % 100, duty_task / 100, duty_task % 100);
+#if MQTT_ENABLED && MQTT_MIRROR_ENABLED
+            static uint32_t last_mirror_bytes = 0;
+            LOG_INFO("mirror %lu bytes/min, %lu messages, %lu keyframes", frame_mirror.getBytes() - last_mirror_bytes,
+                     frame_mirror.getMessages(), frame_mirror.getKeyframes());
+            last_mirror_bytes = frame_mirror.getBytes();
+#endif
+#if STREAM_ENABLED
+            LOG_INFO("stream packets taken/dropped/lost=%lu/%lu/%lu", pixel_stream.getPackets(),
+                     pixel_stream.getDropped(), pixel_stream.getLost());
+#endif
+#if PROFILING_ENABLED
+            logProfile();
+#endif
         }
 
-        led_matrix.setTime(timeinfo->tm_hour, timeinfo->tm_min, timeinfo->tm_sec);
+        // micros() counts the same microseconds as esp_timer_get_time(), in 32 bits
+        led_matrix.setTime(timeinfo->tm_hour, timeinfo->tm_min, timeinfo->tm_sec, (uint32_t) second_begin_us);
     }
 
     // main loop watchdog
     gProcessTimeMainLoop = (millis() - timeBeginLoop);
+    gBusyTimeMainLoop   += micros() - timeBeginLoopUs;
+
+#if !TIME_SIMULATION
+    // nothing to do until the next second begins, the time service tells when exactly that is on the local clock
+    // (the +1 makes sure to wake up after it, not just before)
+    int64_t wait_us = second_end_us - esp_timer_get_time();
+    delay((wait_us > 0) ? wait_us / 1000 + 1 : 1);
+#endif
 }
 
 
 void taskLED(void* parameter)
 {
     led_matrix.setup();
-    
+    led_matrix.setRenderTask(xTaskGetCurrentTaskHandle());
+#if MQTT_ENABLED && MQTT_MIRROR_ENABLED
+    led_matrix.setFrameMirror(&frame_mirror);
+#endif
+#if STREAM_ENABLED
+    pixel_stream.begin();  // the socket is bound to any address, so the wifi need not be connected yet
+    led_matrix.setPixelStream(&pixel_stream);
+#endif
+
     while (true)
     {
-        uint32_t timeBeginLoop = millis();
+        uint32_t timeBeginLoop   = millis();
+        uint32_t timeBeginLoopUs = micros();
 
-        led_matrix.update();
-        vTaskDelay(1);
+        uint32_t wait_ms = led_matrix.update();
 
         gProcessTimeTaskLoop = (millis() - timeBeginLoop);
+        gBusyTimeTaskLoop   += micros() - timeBeginLoopUs;
+
+        // sleep until the next frame is due or something changed (wait at least a tick, to let other tasks run)
+        TickType_t ticks = (wait_ms == LedMatrix::WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(wait_ms);
+        ulTaskNotifyTake(pdTRUE, (ticks > 0) ? ticks : 1);
     }
 }
  
+void taskLog(void* parameter)
+{
+    // lowest priority: formatting and sending the messages never delays anything else
+    Log::setDrainTask(xTaskGetCurrentTaskHandle());
+    while (true)
+    {
+        Log::drain(logOutput);
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));  // notified by the first message in an empty ring
+    }
+}
+
+void taskTime(void* parameter)
+{
+    // sends the ntp requests and takes the replies; waits for nothing but the dns lookup of a server (see
+    // TimeService.h)
+    while (true)
+    {
+        uint32_t wait_ms = time_service.update();
+        vTaskDelay(pdMS_TO_TICKS(wait_ms));
+    }
+}
+
 void taskOTA(void* parameter)
 {
     initOTA();
@@ -233,36 +410,160 @@ void taskOTA(void* parameter)
 
 #if MQTT_ENABLED
 
-void messageReceived(String &topic, String &payload)
+uint8_t word_color_r = 255;  // white, like the LedMatrix starts
+uint8_t word_color_g = 255;
+uint8_t word_color_b = 255;
+
+// the handlers are plain functions, a lambda's conversion to a function pointer is not constexpr before C++17
+void commandRestart(long value)    { ESP.restart(); }
+void commandBrightness(long value) { led_matrix.setBrightness(value * 254 / 100 + 1); }
+void commandColorRed(long value)   { word_color_r = value * 255 / 100; led_matrix.setWordColor(word_color_r, word_color_g, word_color_b); }
+void commandColorGreen(long value) { word_color_g = value * 255 / 100; led_matrix.setWordColor(word_color_r, word_color_g, word_color_b); }
+void commandColorBlue(long value)  { word_color_b = value * 255 / 100; led_matrix.setWordColor(word_color_r, word_color_g, word_color_b); }
+void commandSeconds(long value)    { led_matrix.setSecondsMode(value); }
+void commandSplash(long value)     { led_matrix.setSplashScreen(value); }
+void commandTransition(long value) { led_matrix.setTransition(value); }
+
+constexpr CommandRouter::Command MQTT_COMMANDS[] = {
+    // topic         description         min  max  handler
+    { "restart",     "restart uC",         1,   1, commandRestart    },
+    { "brightness",  "brightness",         0, 100, commandBrightness },
+    { "color/red",   "word color red",     0, 100, commandColorRed   },
+    { "color/green", "word color green",   0, 100, commandColorGreen },
+    { "color/blue",  "word color blue",    0, 100, commandColorBlue  },
+    { "seconds",     "seconds mode",       0,   4, commandSeconds    },
+    { "splash",      "splash screen",      0,   2, commandSplash     },
+    { "transition",  "time transition",    0,   5, commandTransition }
+};
+const uint8_t MQTT_COMMAND_COUNT = sizeof(MQTT_COMMANDS) / sizeof(MQTT_COMMANDS[0]);
+
+// from wordclock_sim --router-seed restart,brightness,color/red,color/green,color/blue,seconds,splash,transition
+constexpr uint32_t MQTT_COMMAND_SEED = 2;
+static_assert(CommandRouter::isPerfect(MQTT_COMMANDS, MQTT_COMMAND_COUNT, MQTT_COMMAND_SEED),
+              "two mqtt commands share a slot, run wordclock_sim --router-seed for a new seed");
+
+CommandRouter mqtt_router("cmnd/" MQTT_DEVICE_ID "/", MQTT_COMMANDS, MQTT_COMMAND_COUNT, MQTT_COMMAND_SEED);
+
+// An effect for the EffectVm on cmnd/<id>/effect (assembled by the simulator, see host/effect_asm.h): checked, shown
+// from now on and stored. The reply on tele/<id>/effect is "ok" or what is wrong with it.
+void receiveEffect(MQTTClient *client, const uint8_t* bytes, int length)
 {
-    auto handleIntRequest = [&](String command, String log_name, int min_value, int max_value, void (*callback)(long)) {
-        if (topic == "cmnd/" MQTT_DEVICE_ID "/" + command)
+    EffectVm::Program program;
+    const char* error = (length <= EffectVm::HEADER_SIZE + EffectVm::MAX_CODE) ? EffectVm::load(bytes, length, &program)
+                                                                               : "code size out of range";
+    if (error == NULL)
+    {
+        led_matrix.setEffect(program);
+        storeEffect(program.kind, bytes, length);
+        LOG_INFO("effect: %s of %u ms, %u instructions", (program.kind == EffectVm::KIND_SPLASH) ? "splash" : "transition",
+                 program.duration_ms, program.instructions);
+    }
+    else
+    {
+        LOG_WARNING("effect rejected: %s", error);
+    }
+    client->publish("tele/" MQTT_DEVICE_ID "/effect", (error == NULL) ? "ok" : error);
+}
+
+void messageReceived(MQTTClient *client, char topic[], char bytes[], int length)
+{
+    if (strcmp(topic, "cmnd/" MQTT_DEVICE_ID "/effect") == 0)
+    {
+        receiveEffect(client, (const uint8_t*) bytes, length);  // binary, not for the router
+        return;
+    }
+
+    // no String objects: the payload is copied to the stack, the router works on the library's buffers
+    char payload[16];
+    if (length >= (int) sizeof(payload))
+    {
+        LOG_WARNING("incoming: %s - payload too long (%d bytes)", topic, length);
+        return;
+    }
+    memcpy(payload, bytes, length);
+    payload[length] = '\0';
+    LOG_INFO("incoming: %s - %s", topic, payload);
+
+    const CommandRouter::Command* command;
+    long value;
+    CommandRouter::Result result = mqtt_router.route(topic, payload, &command, &value);
+    if (result == CommandRouter::ROUTE_OK)
+    {
+        char reply_topic[64];
+        char reply[12];
+        snprintf(reply_topic, sizeof(reply_topic), "tele/" MQTT_DEVICE_ID "/%s", command->name);
+        snprintf(reply, sizeof(reply), "%ld", value);
+        client->publish(reply_topic, reply);
+    }
+    else if (result == CommandRouter::ROUTE_INVALID_ARGUMENT)
+    {
+        LOG_WARNING("invalid argument to set %s '%s'. possible values: [%ld..%ld]",
+                    command->description, payload, (int32_t) command->min_value, (int32_t) command->max_value);
+    }
+    else if (result == CommandRouter::ROUTE_UNKNOWN_COMMAND)
+    {
+        LOG_WARNING("unknown command %s", topic);
+    }
+}
+
+// the log lines logOutput() queued, on tele/<host>/LOG; dropped while the broker is not connected, like before
+void publishLog()
+{
+    MqttLogLine line;
+    uint32_t dropped = mqtt_log_dropped.exchange(0);
+    if (dropped > 0 && mqttClient.connected())
+    {
+        snprintf(line.text, sizeof(line.text), "%u log message(s) dropped for mqtt", (unsigned int) dropped);
+        mqttClient.publish("tele/" THIS_HOST_NAME "/LOG", line.text);
+    }
+    while (xQueueReceive(mqtt_log_queue, &line, 0) == pdTRUE)
+    {
+        if (mqttClient.connected())
         {
-            long payloadInt = payload.toInt();
-            if (payloadInt >= min_value && payloadInt <= max_value)
-            {
-                callback(payloadInt);
-                mqttClient.publish("tele/" MQTT_DEVICE_ID "/" + command, String(payloadInt));
-            }
-            else
-                LOG_PRINTFLN("invalid argument to set %s '%s'. possible values: [%d..%d]", log_name, payload, min_value, max_value);
+            mqttClient.publish("tele/" THIS_HOST_NAME "/LOG", line.text);
         }
-    };
-
-    static uint8_t r = 0, g = 0, b = 0;
-    LOG_PRINTFLN("incoming: %s - %s", topic.c_str(), payload.c_str());
-    handleIntRequest("restart",     "restart uC",       1,   1, [](long int_arg){ ESP.restart(); });
-    handleIntRequest("brightness",  "brightness",       0, 100, [](long int_arg){ led_matrix.setBrightness(int_arg * 254 / 100 + 1); });
-    handleIntRequest("color/red",   "word color red",   0, 100, [](long int_arg){ r = int_arg * 255 / 100; led_matrix.setWordColor(r, g, b); });
-    handleIntRequest("color/green", "word color green", 0, 100, [](long int_arg){ g = int_arg * 255 / 100; led_matrix.setWordColor(r, g, b); });
-    handleIntRequest("color/blue",  "word color blue",  0, 100, [](long int_arg){ b = int_arg * 255 / 100; led_matrix.setWordColor(r, g, b); });
-    handleIntRequest("seconds",     "seconds mode",     0,   4, [](long int_arg){ led_matrix.setSecondsMode(int_arg); });
-    handleIntRequest("splash",      "splash screen",    0,   1, [](long int_arg){ led_matrix.setSplashScreen(int_arg); });
+    }
+}
+
+#if PROFILING_ENABLED
+// the same statistics as logProfile(), as json, one message per stage on tele/<host>/STATS once a minute
+void publishProfile()
+{
+    static uint32_t last_publish_ms = 0;
+    if (!mqttClient.connected() || millis() - last_publish_ms < 60000)
+    {
+        return;
+    }
+    last_publish_ms = millis();
+
+    char json[160];
+    for (uint8_t stage = 0; stage < Profiler::STAGE_COUNT; stage++)
+    {
+        Profiler::formatJson(stage, json, sizeof(json));
+        mqttClient.publish("tele/" THIS_HOST_NAME "/STATS", json);
+    }
+    snprintf(json, sizeof(json), "{\"missed_deadlines\":%lu}", (unsigned long) Profiler::getMissedDeadlines());
+    mqttClient.publish("tele/" THIS_HOST_NAME "/STATS", json);
+}
+#endif
+
+#if MQTT_MIRROR_ENABLED
+// what the leds show, as keyframes and deltas (see FrameMirror.h) on tele/<host>/MIRROR
+void publishMirror()
+{
+    static uint8_t message[FrameMirror::MAX_MESSAGE_SIZE];
+    uint16_t length = frame_mirror.poll(message, sizeof(message));
+    if (length > 0)
+    {
+        mqttClient.publish("tele/" THIS_HOST_NAME "/MIRROR", (const char*) message, length);
+    }
 }
+#endif
+
 void taskMQTT(void* parameter)
 {
     mqttClient.begin(MQTT_BROKER_IP, network);
-    mqttClient.onMessage(messageReceived);
+    mqttClient.onMessageAdvanced(messageReceived);
     while (true)
     {
         if (!mqttClient.connected())
@@ -272,6 +573,9 @@ void taskMQTT(void* parameter)
             {
                 Serial.println("done.");
                 mqttClient.subscribe("cmnd/" MQTT_DEVICE_ID "/#"); // subscribe to all command topics for this device
+#if MQTT_MIRROR_ENABLED
+                frame_mirror.requestKeyframe();  // the deltas published meanwhile got nowhere
+#endif
             }
             else
             {
@@ -279,6 +583,16 @@ void taskMQTT(void* parameter)
             }
         }
         mqttClient.loop();
+        publishLog();
+#if PROFILING_ENABLED
+        publishProfile();
+#endif
+#if MQTT_MIRROR_ENABLED
+        if (mqttClient.connected())
+        {
+            publishMirror();
+        }
+#endif
         vTaskDelay(1);
     } // while (true)
 }
@@ -12,6 +12,18 @@
 #define MQTT_USERNAME             "my-mqtt-user"
 #define MQTT_PASSWORD             "my-mqtt-password"
 #define MQTT_DEVICE_ID            THIS_HOST_NAME
+#define MQTT_MIRROR_ENABLED       false        // what the leds show, compressed, on tele/<host>/MIRROR (see FrameMirror.h)
+#define MQTT_MIRROR_INTERVAL_MS   250          // at most one message per interval, the frames in between are coalesced
+#define MQTT_MIRROR_KEYFRAME_SEC  60           // for dashboards that subscribe later
+
+#define STREAM_ENABLED            false        // realtime pixels from a light controller over udp (DDP), see PixelStream.h
+#define STREAM_PORT               4048         // the DDP default
+#define STREAM_TIMEOUT_MS         2500         // back to the clock when no packet arrived for this long
+
+#define LOG_LEVEL                 3            // 1=error 2=warning 3=info 4=debug, less important messages are not compiled in
+#ifndef PROFILING_ENABLED
+#define PROFILING_ENABLED         false        // latency histograms of the render path, see Profiler.h (not compiled in if false)
+#endif
 
 #define TIME_NTP_SERVER           "ptbtime1.ptb.de", "ptbtime2.ptb.de", "pool.ntp.org"
 #define TIME_POSIX_TIMEZONE_STR   "CET-1CEST,M3.5.0,M10.5.0/3"  // germany/berlin ; see https://www.gnu.org/software/libc/manual/html_node/TZ-Variable.html
@@ -22,10 +34,18 @@
 
 #define MATRIX_WIDTH              13
 #define MATRIX_HEIGHT             11
+#define LETTER_LAYOUT             "LetterLayout_13x11_de.h"  // generated from letter-layout/layout-13x11-de.txt
 #define MATRIX_LED_PIN            13
+#define MATRIX_LED_OUTPUT         LED_OUTPUT_RMT  // LED_OUTPUT_BITBANG, _RMT or _I2S (see LedMatrix.h)
+#define MATRIX_LAYOUT             LAYOUT_SERPENTINE  // how the led chain runs through the matrix (see LedMapping.h)
+#define MATRIX_ROTATION           0            // rotation of the wiring against the letters, clockwise (0, 90, 180, 270)
+#define MATRIX_MIRRORED           false        // wiring mirrored left to right (applied before the rotation)
+#define MATRIX_SEGMENTS           1            // number of identically wired strip segments chained one after another
 #define MATRIX_LED_CHIPSET        WS2812B
 #define MATRIX_LED_COLOR_ORDER    GRB
 #define MATRIX_LED_BRIGHTNESS     13           // max led brightness (0..255)
+#define MATRIX_LED_GAMMA          1.0f         // gamma correction of the output (1.0: none, 2.2 for perceptually even fades)
+#define MATRIX_MAX_FPS            100          // upper limit for frames sent to the leds (unchanged frames are never sent)
 
 
 #endif  // __CONFIGURATION_H
@@ -0,0 +1,41 @@
+#ifndef __INDEX_SEQUENCE_H
+#define __INDEX_SEQUENCE_H
+
+#include <stddef.h>
+
+// Compile time index lists (like std::index_sequence, which is not available in C++11).
+// They are used to expand constexpr generator functions into lookup tables that live in flash:
+//
+//     template<size_t... I> constexpr Table makeTable(Indices<I...>) { return {{ entry(I)... }}; }
+//     constexpr Table TABLE = makeTable(MakeIndices<N>::type());
+//
+// MakeIndices splits in halves, so even tables with thousands of entries stay far below the template depth limit.
+
+template<size_t... I> struct Indices
+{
+    typedef Indices type;
+};
+
+template<typename A, typename B> struct ConcatIndices;
+
+template<size_t... A, size_t... B> struct ConcatIndices<Indices<A...>, Indices<B...>>
+{
+    typedef Indices<A..., (sizeof...(A) + B)...> type;
+};
+
+template<size_t N> struct MakeIndices :
+  ConcatIndices<typename MakeIndices<N / 2>::type, typename MakeIndices<N - N / 2>::type>
+{
+};
+
+template<> struct MakeIndices<0>
+{
+    typedef Indices<> type;
+};
+
+template<> struct MakeIndices<1>
+{
+    typedef Indices<0> type;
+};
+
+#endif  // __INDEX_SEQUENCE_H
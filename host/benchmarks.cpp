@@ -0,0 +1,842 @@
+#include <Arduino.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <NeoPixelBrightnessBus.h>
+#include <WiFi.h>
+
+#include "benchmarks.h"
+#include "CommandRouter.h"
+#include "configuration.h"
+#include "effect_asm.h"
+#include "EffectVm.h"
+#include "FrameBuffer.h"
+#include "golden.h"
+#include "LedMatrix.h"
+#include "Log.h"
+#include "Profiler.h"
+#include "Raster.h"
+#include "TripleBuffer.h"
+#include "VirtualClock.h"
+
+
+typedef uint16_t CoverageMap[MATRIX_HEIGHT][MATRIX_WIDTH];  // 0..256, UINT16_MAX = untouched
+
+static volatile uint32_t bench_sink;  // keeps the compiler from optimizing the work away
+
+// heap allocations of the whole program, to count those of a piece of code
+static std::atomic<uint32_t> heap_allocations(0);
+
+void* operator new(size_t size)
+{
+    heap_allocations++;
+    void* p = malloc(size);
+    if (p == NULL)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+template<typename Func> static double nanosPerCall(uint32_t calls, Func func)
+{
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < calls; i++)
+        func(i);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / calls;
+}
+
+
+// ----- second hand -----
+
+// LedMatrix::drawSecondHand() before the Raster module: a 1500 pixel long double precision Wu line
+template<typename Plot> static void legacySecondHand(uint32_t millis_of_minute, bool dot_only, Plot plot)
+{
+    auto swap = [](int* a, int* b){ int temp = *a; *a = *b; *b = temp; };
+    auto draw = [&](int x, int y, double val){
+        if ((x >= 0) && (x < MATRIX_WIDTH) && (y >= 0) && (y < MATRIX_HEIGHT) &&
+            (!dot_only || x == 0 || x == MATRIX_WIDTH-1 || y == 0 || y == MATRIX_HEIGHT-1))
+        {
+            plot(x, y, val);
+        }
+    };
+
+    const int HAND_LENGTH = 1500;
+
+    double a = (millis_of_minute / 1000.0) * 2 * 3.1415 / 60;
+
+    int x0 = MATRIX_WIDTH  / 2;
+    int y0 = MATRIX_HEIGHT / 2;
+    int x1 = x0 + HAND_LENGTH * sin(a);
+    int y1 = y0 - HAND_LENGTH * cos(a);
+
+    int steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep)
+    {
+        swap(&x0, &y0);
+        swap(&x1, &y1);
+    }
+    if (x0 > x1)
+    {
+        swap(&x0, &x1);
+        swap(&y0, &y1);
+    }
+
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    double gradient = (double)dy / dx;
+    if (dx == 0.0)
+        gradient = 1.0;
+
+    double intery = y0 + gradient;
+    if (steep)
+        for (int x = x0 + 1; x <= x1 - 1; x++)
+        {
+            draw(floor(intery),   x, floor(intery) - intery + 1);
+            draw(floor(intery)+1, x, intery - floor(intery));
+            intery += gradient;
+        }
+    else
+        for (int x = x0 + 1; x <= x1 - 1; x++)
+        {
+            draw(x, floor(intery),   floor(intery) - intery + 1);
+            draw(x, floor(intery)+1, intery - floor(intery));
+            intery += gradient;
+        }
+}
+
+template<typename Plot> static void rasterSecondHand(uint32_t millis_of_minute, bool dot_only, Plot plot)
+{
+    uint16_t angle = Raster::angle(millis_of_minute, 60000);
+    if (dot_only)
+        Raster::ringDot(MATRIX_WIDTH / 2, MATRIX_HEIGHT / 2, angle, plot);
+    else
+        Raster::ray(MATRIX_WIDTH / 2, MATRIX_HEIGHT / 2, angle, plot);
+}
+
+int benchRaster()
+{
+    const uint32_t FRAMES = 60000;  // one frame per millisecond of a minute
+
+    for (int dot_only = 0; dot_only <= 1; dot_only++)
+    {
+        // compare the pixels of both implementations
+        uint32_t max_diff = 0;
+        for (uint32_t ms = 0; ms < FRAMES; ms++)
+        {
+            CoverageMap legacy, raster;
+            memset(legacy, 0xFF, sizeof(legacy));
+            memset(raster, 0xFF, sizeof(raster));
+            legacySecondHand(ms, dot_only, [&](int x, int y, double val){ legacy[y][x] = val * 256 + 0.5; });
+            rasterSecondHand(ms, dot_only, [&](int8_t x, int8_t y, uint16_t cov){ raster[y][x] = cov; });
+            for (uint8_t y = 0; y < MATRIX_HEIGHT; y++)
+                for (uint8_t x = 0; x < MATRIX_WIDTH; x++)
+                {
+                    // pixels touched by only one of both count as full difference
+                    uint16_t l = (legacy[y][x] == UINT16_MAX) ? 0 : legacy[y][x];
+                    uint16_t r = (raster[y][x] == UINT16_MAX) ? 0 : raster[y][x];
+                    uint32_t diff = abs((int) l - (int) r);
+                    max_diff = (diff > max_diff) ? diff : max_diff;
+                }
+        }
+
+        double legacy_ns = nanosPerCall(FRAMES, [&](uint32_t ms){
+            legacySecondHand(ms, dot_only, [&](int x, int y, double val){ bench_sink += x + y + val * 256; });
+        });
+        double raster_ns = nanosPerCall(FRAMES, [&](uint32_t ms){
+            rasterSecondHand(ms, dot_only, [&](int8_t x, int8_t y, uint16_t cov){ bench_sink += x + y + cov; });
+        });
+
+        printf("%-14s  legacy %8.1f ns/frame   raster %6.1f ns/frame   (x%.0f)   max coverage diff %u/256\n",
+               dot_only ? "SECONDS_DOT" : "SECONDS_HAND", legacy_ns, raster_ns, legacy_ns / raster_ns, max_diff);
+    }
+    return 0;
+}
+
+
+// ----- logging -----
+
+// the former printfln_P(): formats on the caller's stack, then writes synchronously ('output' stands in for
+// Serial.println() and the mqtt publish, which come on top of it)
+template<typename Output> static void legacyLog(Output output, const char *fmt, ...)
+{
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    output(buf);
+}
+
+int benchLog()
+{
+    const uint32_t CALLS = 1000000;
+    const char*    FMT   = "%4d-%02d-%02d %02d:%02d:%02d   dst=%d   looptime=%lu ms   topic %s";
+
+    uint32_t sunk = 0;
+    auto sink = [](uint8_t level, uint32_t time_ms, const char* text){ bench_sink += text[0]; };
+
+    double legacy_ns = nanosPerCall(CALLS, [&](uint32_t i){
+        legacyLog([&](const char* text){ sunk += text[0]; }, FMT, 2024, 3, 31, 2, 59, i % 60, 1, 3UL, "cmnd/x");
+    });
+
+    // the ring holds QUEUE_SIZE records, so drain after every batch (timed separately)
+    double write_ns = 0;
+    double drain_ns = 0;
+    for (uint32_t done = 0; done < CALLS; done += Log::QUEUE_SIZE)
+    {
+        write_ns += nanosPerCall(Log::QUEUE_SIZE, [&](uint32_t i){
+            Log::write(LOG_LEVEL_INFO, FMT, 2024, 3, 31, 2, 59, (int) (i % 60), 1, (uint32_t) 3, "cmnd/x");
+        });
+        drain_ns += nanosPerCall(1, [&](uint32_t i){ Log::drain(sink); });
+    }
+    write_ns /= CALLS / Log::QUEUE_SIZE;
+    drain_ns /= CALLS;
+
+    printf("log call        legacy %8.1f ns   async %6.1f ns   (x%.0f)   drain %6.1f ns/message\n",
+           legacy_ns, write_ns, legacy_ns / write_ns, drain_ns);
+
+    // several producers against a concurrent drain: every message arrives intact or is counted as dropped (the
+    // producers yield after every message, so the drain keeps up most of the time)
+    const uint32_t THREADS = 4;
+    const uint32_t PER_THREAD = 5000;
+    std::atomic<bool> running(true);
+    std::atomic<bool> draining(false);
+    static uint32_t received;
+    static uint32_t corrupt;
+    static uint32_t last_seen[THREADS];
+    received = 0;
+    corrupt  = 0;
+    memset(last_seen, 0, sizeof(last_seen));
+    auto check = [](uint8_t level, uint32_t time_ms, const char* text){
+        unsigned int thread, seq, copy;
+        char tag[16];
+        if (sscanf(text, "producer %u message %u %15s %u", &thread, &seq, tag, &copy) == 4 &&
+            thread < THREADS && seq == copy && strcmp(tag, "check") == 0 && seq >= last_seen[thread])
+        {
+            last_seen[thread] = seq + 1;
+            received++;
+        }
+        else if (strstr(text, "dropped") == NULL)
+        {
+            corrupt++;
+        }
+    };
+    uint32_t dropped_before = Log::getDropped();
+    std::thread consumer([&](){
+        draining = true;
+        while (running)
+            Log::drain(check);
+        Log::drain(check);
+    });
+    while (!draining)
+        std::this_thread::yield();
+    std::vector<std::thread> producers;
+    for (uint32_t t = 0; t < THREADS; t++)
+        producers.push_back(std::thread([=](){
+            for (uint32_t i = 0; i < PER_THREAD; i++)
+            {
+                Log::write(LOG_LEVEL_INFO, "producer %u message %u %s %u", t, i, std::string("check").c_str(), i);
+                std::this_thread::yield();
+            }
+        }));
+    for (auto& producer : producers)
+        producer.join();
+    running = false;
+    consumer.join();
+    uint32_t dropped = Log::getDropped() - dropped_before;
+
+    bool ok = (corrupt == 0) && (received + dropped == THREADS * PER_THREAD);
+    printf("%u producers     %u messages: %u received in order, %u dropped (ring full), %u corrupt: %s\n",
+           THREADS, THREADS * PER_THREAD, received, dropped, corrupt, ok ? "ok" : "FAILED");
+    return ok ? 0 : 1;
+}
+
+
+// ----- mqtt commands -----
+
+// what the broker delivers and what the clock answers
+typedef struct {
+    const char* topic;
+    const char* payload;
+    const char* reply;  // published value, NULL if the message is not accepted
+} BrokerMessage;
+
+static const BrokerMessage BROKER_MESSAGES[] = {
+    { "cmnd/" MQTT_DEVICE_ID "/brightness",  "50",   "50"  },
+    { "cmnd/" MQTT_DEVICE_ID "/brightness",  "101",  NULL  },  // out of range
+    { "cmnd/" MQTT_DEVICE_ID "/brightness",  "5x",   NULL  },  // toInt() took this for 5
+    { "cmnd/" MQTT_DEVICE_ID "/brightness",  "",     NULL  },  // toInt() took this for 0
+    { "cmnd/" MQTT_DEVICE_ID "/color/red",   "100",  "100" },
+    { "cmnd/" MQTT_DEVICE_ID "/color/green", "+0",   "0"   },
+    { "cmnd/" MQTT_DEVICE_ID "/color/blue",  "-1",   NULL  },
+    { "cmnd/" MQTT_DEVICE_ID "/seconds",     "4",    "4"   },
+    { "cmnd/" MQTT_DEVICE_ID "/splash",      "1",    "1"   },
+    { "cmnd/" MQTT_DEVICE_ID "/restart",     "1",    "1"   },
+    { "cmnd/" MQTT_DEVICE_ID "/color",       "1",    NULL  },  // unknown command
+    { "cmnd/" MQTT_DEVICE_ID "/seconds/x",   "1",    NULL  },
+    { "cmnd/other/seconds",                  "1",    NULL  },  // other device
+};
+
+static void benchHandler(long value)
+{
+    bench_sink += value;
+}
+
+static constexpr CommandRouter::Command BENCH_COMMANDS[] = {
+    { "restart",     "restart uC",         1,   1, benchHandler },
+    { "brightness",  "brightness",         0, 100, benchHandler },
+    { "color/red",   "word color red",     0, 100, benchHandler },
+    { "color/green", "word color green",   0, 100, benchHandler },
+    { "color/blue",  "word color blue",    0, 100, benchHandler },
+    { "seconds",     "seconds mode",       0,   4, benchHandler },
+    { "splash",      "splash screen",      0,   1, benchHandler }
+};
+static constexpr uint32_t BENCH_COMMAND_SEED = 2;  // wordclock_sim --router-seed restart,brightness,color/red,color/green,color/blue,seconds,splash
+static_assert(CommandRouter::isPerfect(BENCH_COMMANDS, sizeof(BENCH_COMMANDS) / sizeof(BENCH_COMMANDS[0]), BENCH_COMMAND_SEED),
+             "two bench commands share a slot, run wordclock_sim --router-seed for a new seed");
+
+// the former messageReceived(), with std::string standing in for Arduino's String
+static void legacyMessageReceived(const std::string& topic, const std::string& payload, std::string* reply)
+{
+    auto handleIntRequest = [&](std::string command, std::string log_name, int min_value, int max_value) {
+        if (topic == "cmnd/" MQTT_DEVICE_ID "/" + command)
+        {
+            long payloadInt = atol(payload.c_str());
+            if (payloadInt >= min_value && payloadInt <= max_value)
+            {
+                bench_sink += payloadInt;
+                *reply = std::to_string(payloadInt);
+            }
+        }
+    };
+    handleIntRequest("restart",     "restart uC",       1,   1);
+    handleIntRequest("brightness",  "brightness",       0, 100);
+    handleIntRequest("color/red",   "word color red",   0, 100);
+    handleIntRequest("color/green", "word color green", 0, 100);
+    handleIntRequest("color/blue",  "word color blue",  0, 100);
+    handleIntRequest("seconds",     "seconds mode",     0,   4);
+    handleIntRequest("splash",      "splash screen",    0,   1);
+}
+
+// the new messageReceived(), the reply formatted on the stack
+static void routerMessageReceived(const CommandRouter& router, const char* topic, const char* payload, char* reply)
+{
+    const CommandRouter::Command* command;
+    long value;
+    reply[0] = '\0';
+    if (router.route(topic, payload, &command, &value) == CommandRouter::ROUTE_OK)
+        snprintf(reply, 12, "%ld", value);
+}
+
+int benchCommands()
+{
+    const uint32_t MESSAGES = 1000000;
+    const uint32_t COUNT    = sizeof(BROKER_MESSAGES) / sizeof(BROKER_MESSAGES[0]);
+
+    CommandRouter router("cmnd/" MQTT_DEVICE_ID "/", BENCH_COMMANDS, sizeof(BENCH_COMMANDS) / sizeof(BENCH_COMMANDS[0]), BENCH_COMMAND_SEED);
+
+    // the answers of the broker stand-in's messages
+    bool ok = true;
+    for (uint32_t i = 0; i < COUNT; i++)
+    {
+        const BrokerMessage& msg = BROKER_MESSAGES[i];
+        char reply[12];
+        routerMessageReceived(router, msg.topic, msg.payload, reply);
+        bool accepted = (reply[0] != '\0');
+        if (accepted != (msg.reply != NULL) || (accepted && strcmp(reply, msg.reply) != 0))
+        {
+            printf("%s '%s': replied '%s', expected '%s'\n", msg.topic, msg.payload, reply, msg.reply ? msg.reply : "");
+            ok = false;
+        }
+    }
+
+    // the messages as they come from the library: std::string for the legacy handler (Arduino creates the Strings
+    // for onMessage()), plain buffers for the router (onMessageAdvanced())
+    std::string topics[COUNT];
+    std::string payloads[COUNT];
+    for (uint32_t i = 0; i < COUNT; i++)
+    {
+        topics[i]   = BROKER_MESSAGES[i].topic;
+        payloads[i] = BROKER_MESSAGES[i].payload;
+    }
+
+    uint32_t heap_before = heap_allocations;
+    double legacy_ns = nanosPerCall(MESSAGES, [&](uint32_t i){
+        std::string reply;
+        legacyMessageReceived(topics[i % COUNT], payloads[i % COUNT], &reply);
+    });
+    double legacy_allocs = (double) (heap_allocations - heap_before) / MESSAGES;
+
+    heap_before = heap_allocations;
+    double router_ns = nanosPerCall(MESSAGES, [&](uint32_t i){
+        char reply[12];
+        routerMessageReceived(router, BROKER_MESSAGES[i % COUNT].topic, BROKER_MESSAGES[i % COUNT].payload, reply);
+    });
+    double router_allocs = (double) (heap_allocations - heap_before) / MESSAGES;
+
+    printf("mqtt commands   legacy %8.0f per second, %4.1f heap allocations/message\n"
+           "                router %8.0f per second, %4.1f heap allocations/message   (x%.0f)\n",
+           1e9 / legacy_ns, legacy_allocs, 1e9 / router_ns, router_allocs, legacy_ns / router_ns);
+    printf("replies of the broker stand-in: %s\n", ok ? "ok" : "FAILED");
+    return (ok && router_allocs == 0) ? 0 : 1;
+}
+
+
+// ----- render state handoff -----
+
+const uint8_t STATE_WRITERS = 3;
+
+// consistent exactly if the reader never sees a half written or half merged version
+typedef struct {
+    uint32_t count[STATE_WRITERS];  // updates of each writer
+    uint32_t check[STATE_WRITERS];  // ~count, written in a separate step
+    uint32_t total;                 // sum of count
+    uint8_t  fill[64];              // all (uint8_t) total, like the text of the render state
+} BenchState;
+
+static bool isConsistent(const BenchState& state)
+{
+    uint32_t total = 0;
+    for (uint8_t w = 0; w < STATE_WRITERS; w++)
+    {
+        if (state.check[w] != ~state.count[w])
+            return false;
+        total += state.count[w];
+    }
+    for (uint8_t i = 0; i < sizeof(state.fill); i++)
+        if (state.fill[i] != (uint8_t) total)
+            return false;
+    return total == state.total;
+}
+
+// reads snapshots as the render task does until 'running' goes false; returns how many were inconsistent, changed
+// while held, or older than one read before
+static uint32_t readSnapshots(TripleBuffer<BenchState>& handoff, std::atomic<bool>& running, uint32_t* reads,
+                              uint32_t* fresh)
+{
+    uint32_t corrupt = 0;
+    uint32_t last[STATE_WRITERS] = {0};
+    while (running)
+    {
+        bool is_fresh;
+        const BenchState& state = handoff.read(&is_fresh);
+        (*reads)++;
+        *fresh += is_fresh;
+        bool in_order = true;
+        for (uint8_t w = 0; w < STATE_WRITERS; w++)
+        {
+            in_order &= (state.count[w] >= last[w]);
+            last[w]   = state.count[w];
+        }
+        uint32_t total = state.total;
+        std::this_thread::yield();  // like a frame being rendered, the snapshot must not change meanwhile
+        if (!isConsistent(state) || !in_order || state.total != total)
+            corrupt++;
+    }
+    return corrupt;
+}
+
+int benchState()
+{
+    const uint32_t CALLS = 10000000;
+
+    BenchState initial;
+    memset(&initial, 0, sizeof(initial));
+    for (uint8_t w = 0; w < STATE_WRITERS; w++)
+        initial.check[w] = ~0u;
+
+    auto change = [](BenchState& state, uint8_t writer){
+        state.count[writer]++;
+        state.check[writer] = ~state.count[writer];
+        state.total++;
+        memset(state.fill, (uint8_t) state.total, sizeof(state.fill));
+        return true;
+    };
+
+    // what the render task pays at the start of a frame: a mutex protected copy vs. the triple buffer
+    std::mutex mutex;
+    BenchState shared = initial;
+    double mutex_ns = nanosPerCall(CALLS, [&](uint32_t i){
+        std::lock_guard<std::mutex> lock(mutex);
+        BenchState copy = shared;
+        bench_sink += copy.total;
+    });
+
+    TripleBuffer<BenchState> buffer(initial);
+    double read_ns = nanosPerCall(CALLS, [&](uint32_t i){
+        bool fresh;
+        bench_sink += buffer.read(&fresh).total;
+    });
+    double update_ns = nanosPerCall(CALLS / 10, [&](uint32_t i){
+        buffer.update([&](BenchState& state){ return change(state, 0); });
+    });
+
+    TripleBuffer<BenchState> single_buffer(initial);  // written by one task only, no mutex
+    BenchState               single = initial;
+    double publish_ns = nanosPerCall(CALLS / 10, [&](uint32_t i){
+        change(single, 0);
+        single_buffer.writeBuffer() = single;
+        single_buffer.publish();
+    });
+
+    printf("state snapshot  mutex + copy %6.1f ns   triple buffer read %6.1f ns   update %6.1f ns   single writer "
+           "publish %6.1f ns\n", mutex_ns, read_ns, update_ns, publish_ns);
+
+    // several writers against a reader that never waits: every snapshot is consistent, no writer's count ever
+    // goes backwards, and no update gets lost (everybody yields after every access, so they interleave even on a
+    // single cpu)
+    const uint32_t PER_WRITER = 50000;
+    TripleBuffer<BenchState> handoff(initial);
+    std::atomic<bool> running(true);
+    uint32_t reads   = 0;
+    uint32_t fresh   = 0;
+    uint32_t corrupt = 0;
+    std::thread reader([&](){ corrupt = readSnapshots(handoff, running, &reads, &fresh); });
+    std::vector<std::thread> writers;
+    for (uint8_t w = 0; w < STATE_WRITERS; w++)
+        writers.push_back(std::thread([&, w](){
+            for (uint32_t i = 0; i < PER_WRITER; i++)
+            {
+                handoff.update([&](BenchState& state){ return change(state, w); });
+                std::this_thread::yield();
+            }
+        }));
+    for (auto& writer : writers)
+        writer.join();
+    running = false;
+    reader.join();
+
+    const BenchState& final_state = handoff.read();
+    bool complete = isConsistent(final_state);
+    for (uint8_t w = 0; w < STATE_WRITERS; w++)
+        complete &= (final_state.count[w] == PER_WRITER);
+
+    bool ok = (corrupt == 0) && complete;
+    printf("%u writers       %u updates: %u snapshots read (%u new), %u inconsistent, final state %s: %s\n",
+           STATE_WRITERS, STATE_WRITERS * PER_WRITER, reads, fresh, corrupt, complete ? "complete" : "INCOMPLETE",
+           ok ? "ok" : "FAILED");
+
+    // the same with one writer that publishes without the mutex, like the render task offering frames
+    TripleBuffer<BenchState> single_handoff(initial);
+    running = true;
+    reads   = 0;
+    fresh   = 0;
+    std::thread single_reader([&](){ corrupt = readSnapshots(single_handoff, running, &reads, &fresh); });
+    std::thread single_writer([&](){
+        BenchState state = initial;
+        for (uint32_t i = 0; i < PER_WRITER; i++)
+        {
+            change(state, 0);
+            single_handoff.writeBuffer() = state;
+            single_handoff.publish();
+            std::this_thread::yield();
+        }
+    });
+    single_writer.join();
+    running = false;
+    single_reader.join();
+
+    bool single_ok = (corrupt == 0) && isConsistent(single_handoff.read()) &&
+                     single_handoff.read().count[0] == PER_WRITER;
+    printf("1 writer        %u publishes: %u snapshots read (%u new), %u inconsistent: %s\n", PER_WRITER, reads,
+           fresh, corrupt, single_ok ? "ok" : "FAILED");
+    return (ok && single_ok) ? 0 : 1;
+}
+
+
+// ----- effects -----
+
+#if PROFILING_ENABLED
+
+static const uint8_t EFFECT_RUNS = 5;
+
+// Runs 'scene' EFFECT_RUNS times and prints the median of the average per-frame cost of every stage in 'stages'.
+// The scene resets the profiler when the part to measure begins.
+template<typename Scene> static void benchScene(const char* effect, const char* scene_name,
+                                                std::initializer_list<uint8_t> stages, uint32_t probe_ns, Scene scene)
+{
+    std::vector<std::vector<uint32_t>> averages(stages.size());
+    std::vector<uint32_t> frames(stages.size());
+    for (uint8_t run = 0; run < EFFECT_RUNS; run++)
+    {
+        scene();
+        uint8_t i = 0;
+        for (uint8_t stage : stages)
+        {
+            Profiler::Histogram h;
+            Profiler::snapshot(stage, &h);
+            averages[i].push_back(Profiler::averageNs(h));
+            frames[i++] = h.count;
+        }
+    }
+    uint8_t i = 0;
+    for (uint8_t stage : stages)
+    {
+        std::sort(averages[i].begin(), averages[i].end());
+        uint32_t median = averages[i][EFFECT_RUNS / 2];
+        printf("%-18s %-12s %-17s %8.3f us/frame   %7u frames\n", effect, scene_name, Profiler::stageName(stage),
+               ((median > probe_ns) ? median - probe_ns : 0) / 1000.0, frames[i]);
+        effect = "";
+        i++;
+    }
+}
+
+// the splash screen until it is over
+static void splashScene(uint8_t splash_idx)
+{
+    LedMatrix led_matrix;
+    led_matrix.setSplashScreen(splash_idx);
+    led_matrix.setup();
+    led_matrix.setRenderTask(xTaskGetCurrentTaskHandle());
+    uint64_t next_update_us = 0;
+    Profiler::reset();
+    runSplashScreen(led_matrix, &next_update_us);
+}
+
+// ten minutes of the time in a seconds mode, a new second every second, after the splash screen
+static void timeScene(uint8_t seconds_mode)
+{
+    LedMatrix led_matrix;
+    led_matrix.setSecondsMode(seconds_mode);
+    led_matrix.setup();
+    led_matrix.setRenderTask(xTaskGetCurrentTaskHandle());
+    uint64_t next_update_us = 0;
+    runSplashScreen(led_matrix, &next_update_us);
+
+    Profiler::reset();
+    for (uint32_t second = 10 * 3600; second < 10 * 3600 + 600; second++)
+    {
+        setTimeOnSecond(led_matrix, second / 3600, (second / 60) % 60, second % 60, &next_update_us);
+    }
+    runLedTask(led_matrix, VirtualClock::micros() + 1000000, &next_update_us);
+}
+
+int benchEffects()
+{
+    WiFi.setStatus(WL_CONNECTED);
+    EmuLedStrip::setHistoryLimit(0);
+
+    // what a probe measures of itself
+    Profiler::reset();
+    for (uint32_t i = 0; i < 1000000; i++)
+    {
+        PROFILE_SCOPE(Profiler::STAGE_COMPOSE);
+    }
+    Profiler::Histogram h;
+    Profiler::snapshot(Profiler::STAGE_COMPOSE, &h);
+    uint32_t probe_ns = Profiler::averageNs(h);
+    printf("per-frame cost of the effects [host cpu], median of %u runs, probe overhead of %u ns subtracted\n",
+           EFFECT_RUNS, probe_ns);
+
+    benchScene("splashRandom",     "splash 0",    { Profiler::STAGE_SPLASH_RANDOM }, probe_ns,
+               [](){ splashScene(0); });
+    benchScene("splashSnake2",     "splash 1",    { Profiler::STAGE_SPLASH_SNAKE2 }, probe_ns,
+               [](){ splashScene(1); });
+    benchScene("transitions",      "hidden",      { Profiler::STAGE_TRANS_FADE, Profiler::STAGE_TRANS_WIPE,
+                                                    Profiler::STAGE_TRANS_TYPEWRITER, Profiler::STAGE_TRANS_DISSOLVE,
+                                                    Profiler::STAGE_COMPOSE }, probe_ns,
+               [](){ timeScene(LedMatrix::SECONDS_HIDDEN); });
+    benchScene("drawSecondHand",   "hand",        { Profiler::STAGE_COMPOSE, Profiler::STAGE_TRANS_FADE }, probe_ns,
+               [](){ timeScene(LedMatrix::SECONDS_HAND); });
+    benchScene("",                 "dot",         { Profiler::STAGE_COMPOSE, Profiler::STAGE_TRANS_FADE }, probe_ns,
+               [](){ timeScene(LedMatrix::SECONDS_DOT); });
+    benchScene("drawSecondDigits", "decimal",     { Profiler::STAGE_COMPOSE }, probe_ns,
+               [](){ timeScene(LedMatrix::SECONDS_DECIMAL); });
+    benchScene("",                 "countdown",   { Profiler::STAGE_COMPOSE }, probe_ns,
+               [](){ timeScene(LedMatrix::SECONDS_COUNTDOWN); });
+    return 0;
+}
+
+#else
+
+int benchEffects()
+{
+    printf("the effects benchmark reads the profiler, build with PROFILING=1\n");
+    return 1;
+}
+
+#endif  // PROFILING_ENABLED
+
+
+// ----- effect vm -----
+
+static const char* const FADE_EFFECT = "effects/fade.fxa";  // relative to host/, where 'make bench' runs
+
+#if PROFILING_ENABLED
+
+// ten minutes of the time with seconds hidden and only the transition 'transition' (see LedMatrix::setTransition()),
+// with 'effect' uploaded
+static void transitionScene(uint8_t transition, const EffectVm::Program& effect)
+{
+    LedMatrix led_matrix;
+    led_matrix.setSecondsMode(LedMatrix::SECONDS_HIDDEN);
+    led_matrix.setTransition(transition);
+    led_matrix.setEffect(effect);
+    led_matrix.setup();
+    led_matrix.setRenderTask(xTaskGetCurrentTaskHandle());
+    uint64_t next_update_us = 0;
+    runSplashScreen(led_matrix, &next_update_us);
+
+    Profiler::reset();
+    for (uint32_t minute = 10 * 60; minute < 10 * 60 + 10; minute++)
+    {
+        uint64_t begin_us = setTimeOnSecond(led_matrix, minute / 60, minute % 60, 0, &next_update_us);
+        runLedTask(led_matrix, begin_us + 1000000, &next_update_us);
+    }
+}
+
+#endif  // PROFILING_ENABLED
+
+int benchVm()
+{
+    std::vector<uint8_t> bytes;
+    std::string error;
+    EffectVm::Program fade;
+    if (!assembleEffectFile(FADE_EFFECT, &bytes, &error) || EffectVm::load(bytes.data(), bytes.size(), &fade) != NULL)
+    {
+        printf("%s\n", error.c_str());
+        return 1;
+    }
+
+    // one pixel of LedMatrix::transFade() (without setting it) vs. the same in the vm, on the same inputs: pixels
+    // fading in and out between black, white and a color, at every millisecond of the fades
+    typedef struct {
+        FrameBuffer::Color from;
+        FrameBuffer::Color to;
+        bool               lit;
+        uint16_t           elapsed_ms;
+    } FadePixel;
+    std::vector<FadePixel> pixels;
+    const RgbColor COLORS[3] = { RgbColor(0, 0, 0), RgbColor(255, 255, 255), RgbColor(200, 40, 120) };
+    for (uint16_t elapsed_ms = 0; elapsed_ms < 130; elapsed_ms++)
+        for (const RgbColor& from : COLORS)
+            for (const RgbColor& to : COLORS)
+                pixels.push_back(FadePixel{ FrameBuffer::fromRgb(from), FrameBuffer::fromRgb(to), to != COLORS[0],
+                                            elapsed_ms });
+
+    const uint32_t CALLS = 2000000;
+    double native_ns = nanosPerCall(CALLS, [&](uint32_t i){
+        const FadePixel& p = pixels[i % pixels.size()];
+        uint16_t distance = 0;
+        for (int32_t d : { p.to.R - p.from.R, p.to.G - p.from.G, p.to.B - p.from.B })
+            if (abs(d) > distance)
+                distance = abs(d);
+        uint32_t duration_ms = (uint32_t) distance * (p.lit ? 26 : 128) / 65535;
+        uint16_t t = Easing::inOutCubic(AnimationClock::progress(p.elapsed_ms, duration_ms));
+        bench_sink += Easing::lerp16(p.from.R, p.to.R, t) + Easing::lerp16(p.from.G, p.to.G, t) +
+                      Easing::lerp16(p.from.B, p.to.B, t);
+    });
+    int32_t vars[EffectVm::VAR_COUNT] = {};
+    double vm_ns = nanosPerCall(CALLS, [&](uint32_t i){
+        const FadePixel& p = pixels[i % pixels.size()];
+        vars[EffectVm::VAR_T]      = EffectVm::fromMillis(p.elapsed_ms);
+        vars[EffectVm::VAR_LIT]    = p.lit ? EffectVm::ONE : 0;
+        vars[EffectVm::VAR_FROM_R] = EffectVm::fromChannel(p.from.R);
+        vars[EffectVm::VAR_FROM_G] = EffectVm::fromChannel(p.from.G);
+        vars[EffectVm::VAR_FROM_B] = EffectVm::fromChannel(p.from.B);
+        vars[EffectVm::VAR_TO_R]   = EffectVm::fromChannel(p.to.R);
+        vars[EffectVm::VAR_TO_G]   = EffectVm::fromChannel(p.to.G);
+        vars[EffectVm::VAR_TO_B]   = EffectVm::fromChannel(p.to.B);
+        EffectVm::run(fade, vars);
+        bench_sink += EffectVm::toChannel(vars[EffectVm::VAR_R]) + EffectVm::toChannel(vars[EffectVm::VAR_G]) +
+                      EffectVm::toChannel(vars[EffectVm::VAR_B]);
+    });
+    printf("%s: %u bytes, %u instructions (budget %u per pixel)\n", FADE_EFFECT, (unsigned) bytes.size(),
+           fade.instructions, EffectVm::MAX_INSTRUCTIONS);
+    printf("one pixel      transFade() native %8.1f ns   fade.fxa in the vm %8.1f ns   %5.1fx\n", native_ns, vm_ns,
+           vm_ns / native_ns);
+    printf("all %3u pixels transFade() native %8.2f us   fade.fxa in the vm %8.2f us\n", LED_CNT,
+           native_ns * LED_CNT / 1000, vm_ns * LED_CNT / 1000);
+
+#if PROFILING_ENABLED
+    // the same within the LedMatrix, per frame of ten minute changes; the vm runs for the whole .duration while
+    // transFade() finishes a pixel as soon as it reached its color, so it has fewer frames
+    WiFi.setStatus(WL_CONNECTED);
+    EmuLedStrip::setHistoryLimit(0);
+    benchScene("transFade",  "native",    { Profiler::STAGE_TRANS_FADE }, 0,
+               [](){ transitionScene(1, EffectVm::none()); });
+    benchScene("fade.fxa",   "uploaded",  { Profiler::STAGE_TRANS_USER }, 0,
+               [&](){ transitionScene(5, fade); });
+#else
+    printf("per-frame cost in the LedMatrix: build with PROFILING=1\n");
+#endif
+    return 0;
+}
+
+
+// ----- output stage -----
+
+// the bus the LedMatrix drew into before the FrameBuffer: it dims when a pixel is set and undoes it when read back
+typedef NeoPixelBrightnessBus<NeoGrbFeature, Neo800KbpsMethod> DimmingBus;
+
+int benchOutput()
+{
+    const uint8_t  BRIGHTNESS = MATRIX_LED_BRIGHTNESS;
+    const uint32_t FRAMES     = 200000;
+
+    // what the readback loses: every color set and read back at the brightness
+    DimmingBus dimming(LED_CNT, 0);
+    dimming.SetBrightness(BRIGHTNESS);
+    FrameBuffer frame;
+    frame.setBrightness(BRIGHTNESS);
+    uint8_t  max_error = 0;
+    uint16_t distinct  = 0;
+    int16_t  last      = -1;
+    uint16_t exact     = 0;
+    for (uint16_t c = 0; c < 256; c++)
+    {
+        dimming.SetPixelColor(0, RgbColor(c));
+        uint8_t back = dimming.GetPixelColor(0).R;
+        max_error = std::max(max_error, (uint8_t) abs(back - c));
+        distinct += (back != last);
+        last      = back;
+        frame.setPixel(0, RgbColor(c));
+        exact += (FrameBuffer::toRgb(frame.getPixel(0)).R == c);
+    }
+    printf("read back at brightness %u: dimming bus %u distinct values, off by up to %u of 255   frame buffer "
+           "%u of 256 exact\n", BRIGHTNESS, distinct, max_error, exact);
+
+    // a frame of an effect that reads its pixels back (like runEffect()): get, blend towards white, set, for every
+    // pixel; the frame buffer pays the output pass on top
+    NeoPixelBus<NeoGrbFeature, Neo800KbpsMethod> bus(LED_CNT, 0);
+    double dimming_ns = nanosPerCall(FRAMES, [&](uint32_t n){
+        uint16_t t = n & 0x7FFF;
+        for (uint16_t i = 0; i < LED_CNT; i++)
+        {
+            RgbColor c = dimming.GetPixelColor(i);
+            dimming.SetPixelColor(i, RgbColor(Easing::lerp(c.R, 255, t), Easing::lerp(c.G, 255, t),
+                                              Easing::lerp(c.B, 255, t)));
+        }
+        bench_sink += dimming.Pixels()[n % (LED_CNT * 3)];
+    });
+    double frame_ns = nanosPerCall(FRAMES, [&](uint32_t n){
+        uint16_t t = n & 0x7FFF;
+        for (uint16_t i = 0; i < LED_CNT; i++)
+        {
+            FrameBuffer::Color c = frame.getPixel(i);
+            FrameBuffer::Color blended = { Easing::lerp16(c.R, 0xFFFF, t), Easing::lerp16(c.G, 0xFFFF, t),
+                                           Easing::lerp16(c.B, 0xFFFF, t) };
+            frame.setPixel(i, blended);
+        }
+        frame.output(bus);
+        bench_sink += bus.Pixels()[n % (LED_CNT * 3)];
+    });
+    double output_ns = nanosPerCall(FRAMES, [&](uint32_t n){
+        frame.output(bus);
+        bench_sink += bus.Pixels()[n % (LED_CNT * 3)];
+    });
+    printf("all %3u pixels read back, blended, set: dimming bus %8.2f us/frame   frame buffer %8.2f us/frame "
+           "(output pass alone %.2f us)\n", LED_CNT, dimming_ns / 1000, frame_ns / 1000, output_ns / 1000);
+    return 0;
+}
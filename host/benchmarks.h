@@ -0,0 +1,32 @@
+#ifndef __BENCHMARKS_H
+#define __BENCHMARKS_H
+
+// Micro benchmarks of the firmware's hot paths, run by wordclock_sim. Timings are host cpu time, so they
+// only compare implementations with each other; on the esp32 the differences are usually larger (e.g. it
+// has no double precision fpu).
+
+// second hand: legacy double precision Xiaolin Wu line vs. the fixed point Raster module
+int benchRaster();
+
+// logging: synchronous formatting (the former printfln_P()) vs. the asynchronous Log, plus a multi-producer check
+int benchLog();
+
+// mqtt commands: the former per-handler String compares vs. the CommandRouter, against a broker stand-in
+int benchCommands();
+
+// render state handoff: mutex protected copy vs. the TripleBuffer, plus a multi-writer consistency check
+int benchState();
+
+// per-frame cost of the effects (splash screens, transitions, seconds), from the profiler's stages while the led
+// task runs scripted scenes; the median of several runs, less the cost of the probe itself
+int benchEffects();
+
+// uploaded effects: one pixel of the fade as native code (transFade()) vs. host/effects/fade.fxa in the EffectVm, and
+// the per-frame cost of both in the LedMatrix (needs the profiler)
+int benchVm();
+
+// output stage: the former dimming bus, which scaled every set and get, vs. the 16 bit FrameBuffer with its
+// brightness x gamma table applied once per frame; the precision of reading colors back and the cost of a frame
+int benchOutput();
+
+#endif  // __BENCHMARKS_H
@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <map>
+#include <sstream>
+
+#include "effect_asm.h"
+#include "EffectVm.h"
+
+
+static const char* const OP_NAMES[EffectVm::OP_COUNT] = {
+    "end", "push", NULL, "load", "store", "dup", "drop", "swap", "over", "add", "sub", "mul", "div", "min", "max",
+    "lt", "eq", "neg", "abs", "frac", "sin", "clamp", "lerp", "sel", "hue", "jz", "jmp"
+};  // OP_PUSHI has no name of its own, push picks it
+
+static const char* const VAR_NAMES[EffectVm::VAR_COUNT] = {
+    "x", "y", "t", "progress", "phase", "lit", "rand", "from_r", "from_g", "from_b", "to_r", "to_g", "to_b",
+    "r", "g", "b", "v0", "v1", "v2", "v3"
+};
+
+typedef struct {
+    int         line;
+    uint8_t     op;
+    std::string operand;
+    int32_t     value;     // push: Q16.16, load / store: the variable
+    uint16_t    offset;    // in the code
+} Statement;
+
+static bool fail(std::string* error, int line, const std::string& text)
+{
+    *error = (line > 0) ? "line " + std::to_string(line) + ": " + text : text;
+    return false;
+}
+
+static int lookup(const char* const* names, int count, const std::string& name)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (names[i] != NULL && name == names[i])
+            return i;
+    }
+    return -1;
+}
+
+static bool parseNumber(const std::string& text, int32_t* value)
+{
+    char* end;
+    double number = strtod(text.c_str(), &end);
+    if (text.empty() || *end != '\0' || number < -32768.0 || number >= 32768.0)
+        return false;
+    double scaled = number * EffectVm::ONE;
+    *value = (int32_t) (scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+    return true;
+}
+
+bool assembleEffect(const std::string& source, std::vector<uint8_t>* bytes, std::string* error)
+{
+    // first pass: the statements, their offsets and the labels; second: the code, with the jumps resolved
+    std::vector<Statement> statements;
+    std::map<std::string, uint16_t> labels;
+    int      kind        = -1;
+    long     duration_ms = -1;
+    uint16_t offset      = 0;
+
+    std::istringstream lines(source);
+    std::string text;
+    for (int line = 1; std::getline(lines, text); line++)
+    {
+        text = text.substr(0, text.find(';'));
+        std::istringstream words(text);
+        std::string word;
+        if (!(words >> word))
+            continue;
+
+        if (word.back() == ':')
+        {
+            std::string label = word.substr(0, word.size() - 1);
+            if (label.empty() || labels.count(label) > 0)
+                return fail(error, line, "empty or duplicate label '" + label + "'");
+            labels[label] = offset;
+            if (!(words >> word))
+                continue;
+        }
+
+        std::string operand, extra;
+        words >> operand;
+        if (words >> extra)
+            return fail(error, line, "unexpected '" + extra + "'");
+
+        if (word == ".kind")
+        {
+            kind = (operand == "splash") ? EffectVm::KIND_SPLASH : (operand == "transition") ? EffectVm::KIND_TRANSITION : -1;
+            if (kind < 0)
+                return fail(error, line, "the kind is splash or transition");
+            continue;
+        }
+        if (word == ".duration")
+        {
+            char* end;
+            duration_ms = strtol(operand.c_str(), &end, 10);
+            if (operand.empty() || *end != '\0' || duration_ms < 0 || duration_ms > 0xFFFF)
+                return fail(error, line, "the duration is 0..65535 ms");
+            continue;
+        }
+
+        int op = lookup(OP_NAMES, EffectVm::OP_COUNT, word);
+        if (op < 0)
+            return fail(error, line, "unknown instruction '" + word + "'");
+        Statement statement = { line, (uint8_t) op, operand, 0, offset };
+        bool needs_operand = (op == EffectVm::OP_PUSH || op == EffectVm::OP_LOAD || op == EffectVm::OP_STORE ||
+                              op == EffectVm::OP_JZ || op == EffectVm::OP_JMP);
+        if (needs_operand == operand.empty())
+            return fail(error, line, needs_operand ? "missing operand" : "unexpected operand '" + operand + "'");
+
+        if (op == EffectVm::OP_PUSH)
+        {
+            if (!parseNumber(operand, &statement.value))
+                return fail(error, line, "not a number in -32768..32767: '" + operand + "'");
+            if (statement.value % EffectVm::ONE == 0 && statement.value >= -128 * EffectVm::ONE &&
+                statement.value <= 127 * EffectVm::ONE)
+            {
+                statement.op = EffectVm::OP_PUSHI;
+            }
+        }
+        else if (op == EffectVm::OP_LOAD || op == EffectVm::OP_STORE)
+        {
+            statement.value = lookup(VAR_NAMES, EffectVm::VAR_COUNT, operand);
+            if (statement.value < 0)
+                return fail(error, line, "unknown variable '" + operand + "'");
+        }
+        offset += (statement.op == EffectVm::OP_PUSH) ? 5 : needs_operand ? 2 : 1;
+        statements.push_back(statement);
+    }
+    if (kind < 0 || duration_ms < 0)
+        return fail(error, 0, "missing .kind or .duration");
+
+    bytes->assign({ 'F', 'X', EffectVm::VERSION, (uint8_t) kind, (uint8_t) duration_ms, (uint8_t) (duration_ms >> 8) });
+    for (const Statement& statement : statements)
+    {
+        bytes->push_back(statement.op);
+        switch (statement.op)
+        {
+        case EffectVm::OP_PUSH:
+            for (uint8_t i = 0; i < 4; i++)
+                bytes->push_back((uint32_t) statement.value >> (8 * i));
+            break;
+        case EffectVm::OP_PUSHI:
+            bytes->push_back((uint8_t) (int8_t) (statement.value / EffectVm::ONE));
+            break;
+        case EffectVm::OP_LOAD:
+        case EffectVm::OP_STORE:
+            bytes->push_back(statement.value);
+            break;
+        case EffectVm::OP_JZ:
+        case EffectVm::OP_JMP:
+        {
+            uint16_t next  = statement.offset + 2;
+            auto     label = labels.find(statement.operand);
+            if (label == labels.end())
+                return fail(error, statement.line, "unknown label '" + statement.operand + "'");
+            if (label->second < next || label->second - next > 0xFF)
+                return fail(error, statement.line, "'" + statement.operand + "' is not up to 255 bytes ahead");
+            bytes->push_back(label->second - next);
+            break;
+        }
+        }
+    }
+
+    if (bytes->size() > EffectVm::HEADER_SIZE + EffectVm::MAX_CODE)
+        return fail(error, 0, "code size out of range");
+    EffectVm::Program program;
+    const char* invalid = EffectVm::load(bytes->data(), bytes->size(), &program);
+    if (invalid != NULL)
+        return fail(error, 0, invalid);
+    return true;
+}
+
+bool assembleEffectFile(const char* path, std::vector<uint8_t>* bytes, std::string* error)
+{
+    FILE* file = fopen(path, "r");
+    if (file == NULL)
+    {
+        *error = std::string("cannot read ") + path;
+        return false;
+    }
+    std::string source;
+    char buffer[512];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        source.append(buffer, n);
+    fclose(file);
+    if (!assembleEffect(source, bytes, error))
+    {
+        *error = std::string(path) + ": " + *error;
+        return false;
+    }
+    return true;
+}
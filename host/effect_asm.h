@@ -0,0 +1,26 @@
+#ifndef __EFFECT_ASM_H
+#define __EFFECT_ASM_H
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+// Assembles the text of an uploadable effect (see EffectVm.h) into the bytes to upload: header and code. Returns
+// true if it succeeded, else 'error' says what is wrong and in which line. The text has one statement per line:
+//
+//   ; a comment, until the end of the line
+//   .kind splash | transition
+//   .duration MS                  (0 removes the effect of the kind)
+//   label:                        may be followed by an instruction; jumps only go forward
+//   instruction [operand]         the EffectVm::OP_* in lower case, without the prefix
+//
+// push takes a decimal number (with a sign and a fraction, e.g. -0.25) and becomes the short OP_PUSHI for small
+// integers; load and store take a variable, the EffectVm::VAR_* in lower case without the prefix (e.g. from_r);
+// jz and jmp take a label. load() checks the rest, assembleEffect() calls it on the result.
+bool assembleEffect(const std::string& source, std::vector<uint8_t>* bytes, std::string* error);
+
+// the same for the text in the file at 'path'
+bool assembleEffectFile(const char* path, std::vector<uint8_t>* bytes, std::string* error);
+
+#endif  // __EFFECT_ASM_H
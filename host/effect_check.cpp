@@ -0,0 +1,274 @@
+#include <Arduino.h>
+#include <NeoPixelBus.h>
+#include <WiFi.h>
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "effect_asm.h"
+#include "effect_check.h"
+#include "EffectVm.h"
+#include "golden.h"
+#include "LedMatrix.h"
+#include "VirtualClock.h"
+
+
+static const uint16_t MINUTES        = 30;
+static const uint32_t MINUTE_US      = 2000000;  // virtual time per minute, the transitions are over long before
+static const uint32_t SAMPLE_US      = 5000;     // frames compared during a transition
+static const uint32_t SAMPLE_SPAN_US = 300000;
+static const uint8_t  FADE_TOLERANCE = 2;        // levels per channel between fade.fxa and transFade(), rounding
+
+typedef struct {
+    const char*          rule;
+    std::vector<uint8_t> code;  // without the header
+} BadProgram;
+
+static std::vector<uint8_t> withHeader(uint8_t kind, uint16_t duration_ms, const std::vector<uint8_t>& code)
+{
+    std::vector<uint8_t> bytes = { 'F', 'X', EffectVm::VERSION, kind, (uint8_t) duration_ms, (uint8_t) (duration_ms >> 8) };
+    bytes.resize(EffectVm::HEADER_SIZE + code.size());
+    std::copy(code.begin(), code.end(), bytes.begin() + EffectVm::HEADER_SIZE);
+    return bytes;
+}
+
+static int checkVerifier()
+{
+    std::vector<uint8_t> too_long = { EffectVm::OP_PUSHI, 0 };
+    too_long.insert(too_long.end(), EffectVm::MAX_INSTRUCTIONS, EffectVm::OP_NEG);
+    too_long.insert(too_long.end(), { EffectVm::OP_DROP, EffectVm::OP_END });
+    std::vector<uint8_t> too_deep;
+    for (uint8_t i = 0; i <= EffectVm::STACK_SIZE; i++)
+        too_deep.insert(too_deep.end(), { EffectVm::OP_PUSHI, i });
+    too_deep.push_back(EffectVm::OP_END);
+
+    const BadProgram BAD_PROGRAMS[] = {
+        { "unknown instruction",      { EffectVm::OP_COUNT, EffectVm::OP_END } },
+        { "stack underflow",          { EffectVm::OP_PUSHI, 1, EffectVm::OP_ADD, EffectVm::OP_END } },
+        { "stack overflow",           too_deep },
+        { "writes an input",          { EffectVm::OP_PUSHI, 1, EffectVm::OP_STORE, EffectVm::VAR_X, EffectVm::OP_END } },
+        { "unknown variable",         { EffectVm::OP_LOAD, EffectVm::VAR_COUNT, EffectVm::OP_DROP, EffectVm::OP_END } },
+        { "jump beyond the end",      { EffectVm::OP_JMP, 1, EffectVm::OP_END } },
+        { "jump into an operand",     { EffectVm::OP_PUSHI, 0, EffectVm::OP_JZ, 1, EffectVm::OP_PUSHI, 5,
+                                        EffectVm::OP_DROP, EffectVm::OP_END } },
+        { "depth differs at a merge", { EffectVm::OP_PUSHI, 0, EffectVm::OP_JZ, 2, EffectVm::OP_PUSHI, 1,
+                                        EffectVm::OP_END } },
+        { "unreachable code",         { EffectVm::OP_END, EffectVm::OP_END } },
+        { "no END at the end",        { EffectVm::OP_PUSHI, 1, EffectVm::OP_DROP } },
+        { "operand beyond the end",   { EffectVm::OP_PUSH, 0, 0 } },
+        { "over the frame budget",    too_long },
+        { "too big",                  std::vector<uint8_t>(EffectVm::MAX_CODE + 1, EffectVm::OP_END) },
+        { "empty",                    {} }
+    };
+
+    // the bad programs, plus broken headers of a good one
+    std::vector<std::pair<const char*, std::vector<uint8_t>>> uploads;
+    for (const BadProgram& bad : BAD_PROGRAMS)
+        uploads.push_back({ bad.rule, withHeader(EffectVm::KIND_TRANSITION, 100, bad.code) });
+    std::vector<uint8_t> good = withHeader(EffectVm::KIND_SPLASH, 100, { EffectVm::OP_END });
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        static const char* const HEADER_FIELDS[4] = { "magic", "magic", "version", "kind" };
+        std::vector<uint8_t> broken = good;
+        broken[i] ^= 0x40;
+        uploads.push_back({ HEADER_FIELDS[i], broken });
+    }
+    uploads.push_back({ "header cut short", std::vector<uint8_t>(good.begin(), good.begin() + 5) });
+
+    uint16_t accepted = 0;
+    for (auto& upload : uploads)
+    {
+        EffectVm::Program program = EffectVm::none();
+        const char* error = EffectVm::load(upload.second.data(), upload.second.size(), &program);
+        if (error == NULL || program.kind != EffectVm::KIND_NONE)
+        {
+            printf("  verifier accepted a program that breaks the rule: %s\n", upload.first);
+            accepted++;
+        }
+    }
+    EffectVm::Program program;
+    bool good_ok = (EffectVm::load(good.data(), good.size(), &program) == NULL && program.kind == EffectVm::KIND_SPLASH);
+    printf("verifier: %u of %u bad programs rejected, the good one %s\n", (unsigned) (uploads.size() - accepted),
+           (unsigned) uploads.size(), good_ok ? "accepted" : "REJECTED");
+    return (accepted == 0 && good_ok) ? 0 : 1;
+}
+
+// A clock showing MINUTES minutes with the transition 'transition' (see LedMatrix::setTransition()) and 'effect'
+// uploaded (if not empty). 'samples' gets the frame on the leds every SAMPLE_US of the first SAMPLE_SPAN_US of
+// every minute; returns the number of minutes that did not end on the frame of their time.
+static uint16_t runTransition(uint8_t transition, const std::vector<uint8_t>& effect, std::vector<Frame>* samples)
+{
+    Frame shown(LED_CNT * NeoGrbFeature::PixelSize, 0);
+    EmuLedStrip::setShowHook([&](uint64_t time_us, const uint8_t* data, size_t size){
+        shown.assign(data, data + size);
+    });
+
+    LedMatrix led_matrix;
+    led_matrix.setBrightness(255);
+    led_matrix.setSecondsMode(LedMatrix::SECONDS_HIDDEN);
+    led_matrix.setTransition(transition);
+    if (!effect.empty())
+    {
+        EffectVm::Program program;
+        EffectVm::load(effect.data(), effect.size(), &program);
+        led_matrix.setEffect(program);
+    }
+    led_matrix.setup();
+    led_matrix.setRenderTask(xTaskGetCurrentTaskHandle());
+    uint64_t next_update_us = 0;
+    runSplashScreen(led_matrix, &next_update_us);
+
+    uint16_t wrong = 0;
+    for (uint16_t minute = 0; minute < MINUTES; minute++)
+    {
+        uint64_t begin_us = setTimeOnSecond(led_matrix, 10, minute, 0, &next_update_us);
+        for (uint32_t t = 0; t < SAMPLE_SPAN_US; t += SAMPLE_US)
+        {
+            runLedTask(led_matrix, begin_us + t, &next_update_us);
+            samples->push_back(shown);
+        }
+        runLedTask(led_matrix, begin_us + MINUTE_US, &next_update_us);
+        wrong += (shown != timeFrame(10, minute, RgbColor(255)));
+    }
+    EmuLedStrip::setShowHook(NULL);
+    return wrong;
+}
+
+// the uploaded splash screen 'effect' (none if empty), then the time; returns whether it ran for its duration
+// (a frame at least every 50 ms) and then showed the time
+static bool runSplash(const std::vector<uint8_t>& effect, uint16_t duration_ms, uint32_t* frames)
+{
+    uint64_t start_us = (VirtualClock::micros() / 1000000 + 1) * 1000000;
+    uint64_t last_us  = start_us;
+    uint32_t longest_gap_us = 0;
+    *frames = 0;
+    Frame shown(LED_CNT * NeoGrbFeature::PixelSize, 0);
+    EmuLedStrip::setShowHook([&](uint64_t time_us, const uint8_t* data, size_t size){
+        shown.assign(data, data + size);
+        if (time_us < start_us + duration_ms * 1000ULL)
+        {
+            longest_gap_us = std::max(longest_gap_us, (uint32_t) (time_us - last_us));
+            last_us = time_us;
+            (*frames)++;
+        }
+    });
+
+    VirtualClock::advance(start_us - VirtualClock::micros());
+    LedMatrix led_matrix;
+    led_matrix.setBrightness(255);
+    led_matrix.setSecondsMode(LedMatrix::SECONDS_HIDDEN);
+    led_matrix.setTime(10, 0, 0, start_us);
+    if (!effect.empty())
+    {
+        EffectVm::Program program;
+        EffectVm::load(effect.data(), effect.size(), &program);
+        led_matrix.setEffect(program);
+    }
+    led_matrix.setSplashScreen(2);
+    led_matrix.setup();
+    led_matrix.setRenderTask(xTaskGetCurrentTaskHandle());
+    uint64_t next_update_us = 0;
+    for (uint8_t second = 1; second <= duration_ms / 1000 + 2; second++)
+    {
+        // the main loop sets the time every second, which also wakes the led task when the splash is over
+        runLedTask(led_matrix, start_us + second * 1000000ULL, &next_update_us);
+        led_matrix.setTime(10, 0, second, start_us + second * 1000000ULL);
+        next_update_us = VirtualClock::micros();
+    }
+    runLedTask(led_matrix, VirtualClock::micros() + 1000000, &next_update_us);
+    EmuLedStrip::setShowHook(NULL);
+
+    uint32_t tail_us = start_us + duration_ms * 1000ULL - last_us;  // the last frame before the end
+    return std::max(longest_gap_us, tail_us) <= 50000 && shown == timeFrame(10, 0, RgbColor(255));
+}
+
+int verifyEffects(const char* dir)
+{
+    WiFi.setStatus(WL_CONNECTED);
+    EmuLedStrip::setHistoryLimit(0);
+    int failed = checkVerifier();
+
+    DIR* listing = opendir(dir);
+    if (listing == NULL)
+    {
+        printf("cannot list %s\n", dir);
+        return 1;
+    }
+    std::vector<std::string> paths;
+    while (struct dirent* entry = readdir(listing))
+    {
+        std::string name = entry->d_name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".fxa") == 0)
+            paths.push_back(std::string(dir) + "/" + name);
+    }
+    closedir(listing);
+    std::sort(paths.begin(), paths.end());
+
+    std::vector<uint8_t> fade;
+    for (const std::string& path : paths)
+    {
+        std::vector<uint8_t> bytes;
+        std::string error;
+        if (!assembleEffectFile(path.c_str(), &bytes, &error))
+        {
+            printf("%s\n", error.c_str());
+            failed = 1;
+            continue;
+        }
+        EffectVm::Program program;
+        EffectVm::load(bytes.data(), bytes.size(), &program);
+        printf("%-24s %-10s %3u bytes, %3u instructions: ", path.c_str(),
+               (program.kind == EffectVm::KIND_SPLASH) ? "splash" : "transition", (unsigned) bytes.size(),
+               program.instructions);
+
+        if (program.kind == EffectVm::KIND_SPLASH)
+        {
+            uint32_t frames;
+            bool ok = runSplash(bytes, program.duration_ms, &frames);
+            printf("%u frames in %u ms, then the time: %s\n", frames, program.duration_ms, ok ? "ok" : "FAILED");
+            failed |= !ok;
+        }
+        else
+        {
+            std::vector<Frame> samples;
+            uint16_t wrong = runTransition(5, bytes, &samples);
+            printf("%u of %u minutes end on the time: %s\n", MINUTES - wrong, MINUTES, (wrong == 0) ? "ok" : "FAILED");
+            failed |= (wrong != 0);
+            if (path.size() >= 9 && path.compare(path.size() - 9, 9, "/fade.fxa") == 0)
+                fade = bytes;
+        }
+    }
+
+    uint32_t frames;
+    bool ok = runSplash(std::vector<uint8_t>(), 0, &frames);
+    printf("splash screen 2 without a program: over at once, then the time: %s\n", ok ? "ok" : "FAILED");
+    failed |= !ok;
+
+    if (fade.empty())
+    {
+        printf("no fade.fxa in %s to compare with transFade()\n", dir);
+        return 1;
+    }
+    std::vector<Frame> native, interpreted;
+    runTransition(1, std::vector<uint8_t>(), &native);
+    runTransition(5, fade, &interpreted);
+    uint32_t largest = 0, differing = 0;
+    for (size_t i = 0; i < native.size() && i < interpreted.size(); i++)
+    {
+        uint32_t diff = 0;
+        for (size_t c = 0; c < native[i].size(); c++)
+        {
+            diff = std::max(diff, (uint32_t) abs(native[i][c] - interpreted[i][c]));
+        }
+        largest    = std::max(largest, diff);
+        differing += (diff > 0);
+    }
+    ok = (native.size() == interpreted.size()) && largest <= FADE_TOLERANCE;
+    printf("fade.fxa vs. transFade(): %u of %u frames differ, by at most %u levels (limit %u): %s\n", differing,
+           (unsigned) native.size(), largest, FADE_TOLERANCE, ok ? "ok" : "FAILED");
+    failed |= !ok;
+    return failed;
+}
@@ -0,0 +1,10 @@
+#ifndef __EFFECT_CHECK_H
+#define __EFFECT_CHECK_H
+
+// Checks the uploadable effects (see EffectVm.h): assembles every *.fxa in 'dir', feeds the verifier programs that
+// break each rule of the sandbox, and runs the effects in the LedMatrix: every transition must end each minute on
+// the frame of the time, every splash screen must run for its duration and then hand over to the time. fade.fxa
+// must stay within a few levels of the native transFade() throughout. Returns 0 if all of it holds.
+int verifyEffects(const char* dir);
+
+#endif  // __EFFECT_CHECK_H
@@ -0,0 +1,75 @@
+#ifndef __EMU_ARDUINO_H
+#define __EMU_ARDUINO_H
+
+// Minimal stand-in for the Arduino-ESP32 core, just enough to compile the word clock core on a Linux host.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define PSTR(s)                  (s)
+#define pgm_read_byte(addr)      (*(const uint8_t*) (addr))
+#define pgm_read_word(addr)      (*(const uint16_t*) (addr))
+#define pgm_read_dword(addr)     (*(const uint32_t*) (addr))
+#define memcpy_P                 memcpy
+#define vsnprintf_P              vsnprintf
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+uint16_t analogRead(uint8_t pin);
+
+
+class HardwareSerial
+{
+
+public:
+
+    void begin(unsigned long baud);
+
+    size_t print(const char* str);
+    size_t println(const char* str = "");
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+    void setMuted(bool muted);  // emulation only: suppress all output
+
+private:
+
+    bool muted_ = false;
+
+};
+
+extern HardwareSerial Serial;
+
+
+#define F_CPU  240000000L
+
+// the cpu's cycle counter runs at F_CPU in real time, not in virtual time: profiling measures the host
+class EspClass
+{
+
+public:
+
+    uint32_t getCycleCount();
+
+};
+
+extern EspClass ESP;
+
+#endif  // __EMU_ARDUINO_H
@@ -0,0 +1,573 @@
+#include <Arduino.h>
+#include <NeoPixelBus.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <esp_timer.h>
+#include <freertos/semphr.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "VirtualClock.h"
+
+
+// ----- virtual clock -----
+
+std::atomic<uint64_t> VirtualClock::now_us_(0);
+
+uint64_t VirtualClock::micros()
+{
+    return now_us_;
+}
+
+void VirtualClock::advance(uint64_t us)
+{
+    now_us_ += us;
+}
+
+void VirtualClock::set(uint64_t us)
+{
+    now_us_ = us;
+}
+
+
+int64_t esp_timer_get_time()
+{
+    return VirtualClock::micros();
+}
+
+
+// ----- arduino core -----
+
+static uint32_t random_state = 0x2545f491;
+
+unsigned long millis()
+{
+    return VirtualClock::micros() / 1000;
+}
+
+unsigned long micros()
+{
+    return VirtualClock::micros();
+}
+
+void delay(uint32_t ms)
+{
+    VirtualClock::advance(ms * 1000ULL);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    VirtualClock::advance(us);
+}
+
+long random(long howbig)
+{
+    if (howbig <= 0)
+        return 0;
+    // xorshift32: deterministic, so every simulation run is reproducible
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state % howbig;
+}
+
+long random(long howsmall, long howbig)
+{
+    if (howsmall >= howbig)
+        return howsmall;
+    return howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed)
+{
+    if (seed != 0)
+        random_state = seed;
+}
+
+uint16_t analogRead(uint8_t pin)
+{
+    return 0;  // a floating pin is as good as any constant here
+}
+
+EspClass ESP;
+
+uint32_t EspClass::getCycleCount()
+{
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch()).count();
+    return ns * (F_CPU / 1000000) / 1000;
+}
+
+HardwareSerial Serial;
+
+void HardwareSerial::begin(unsigned long baud)
+{
+}
+
+size_t HardwareSerial::print(const char* str)
+{
+    return this->muted_ ? 0 : fputs(str, stdout);
+}
+
+size_t HardwareSerial::println(const char* str)
+{
+    return this->muted_ ? 0 : printf("%s\n", str);
+}
+
+size_t HardwareSerial::printf(const char* fmt, ...)
+{
+    if (this->muted_)
+        return 0;
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vprintf(fmt, ap);
+    va_end(ap);
+    return (n > 0) ? n : 0;
+}
+
+void HardwareSerial::setMuted(bool muted)
+{
+    this->muted_ = muted;
+}
+
+
+// ----- wifi -----
+
+WiFiClass WiFi;
+
+wl_status_t WiFiClass::status()
+{
+    return this->status_;
+}
+
+int WiFiClass::hostByName(const char* host, IPAddress& address)
+{
+    return EmuNetwork::resolve(host, &address) ? 1 : 0;
+}
+
+void WiFiClass::setStatus(wl_status_t status)
+{
+    this->status_ = status;
+}
+
+
+// ----- network -----
+
+typedef struct
+{
+    uint16_t             port;
+    uint64_t             time_us;
+    std::vector<uint8_t> data;
+} EmuDatagram;
+
+static std::map<std::pair<std::string, uint16_t>, EmuNetwork::UdpService> network_services;
+static std::vector<EmuDatagram>                                        network_in_flight;
+static std::vector<std::string>                                        network_hosts;  // by address - 10.0.0.1
+static uint32_t                                                        network_lookups = 0;
+static const uint32_t                                                  NETWORK_FIRST_ADDRESS = 0x0A000001;
+
+void EmuNetwork::addUdpService(const char* host, uint16_t port, UdpService service)
+{
+    network_services[std::make_pair(std::string(host), port)] = service;
+    if (std::find(network_hosts.begin(), network_hosts.end(), host) == network_hosts.end())
+        network_hosts.push_back(host);
+}
+
+void EmuNetwork::clearUdpServices()
+{
+    network_services.clear();
+    network_in_flight.clear();
+    network_hosts.clear();
+}
+
+bool EmuNetwork::resolve(const char* host, IPAddress* address)
+{
+    network_lookups++;
+    auto it = std::find(network_hosts.begin(), network_hosts.end(), host);
+    if (it == network_hosts.end())
+        return false;
+    *address = IPAddress(NETWORK_FIRST_ADDRESS + (it - network_hosts.begin()));
+    return true;
+}
+
+uint32_t EmuNetwork::getLookups()
+{
+    return network_lookups;
+}
+
+void EmuNetwork::deliver(uint16_t port, uint64_t time_us, const std::vector<uint8_t>& datagram)
+{
+    network_in_flight.push_back(EmuDatagram{port, time_us, datagram});
+}
+
+bool EmuNetwork::send(const char* host, uint16_t port, uint16_t from_port, const std::vector<uint8_t>& datagram)
+{
+    auto service = network_services.find(std::make_pair(std::string(host), port));
+    if (service == network_services.end())
+        return false;
+    service->second(datagram, from_port);
+    return true;
+}
+
+bool EmuNetwork::receive(uint16_t port, std::vector<uint8_t>* datagram)
+{
+    // the earliest one that has arrived
+    auto next = network_in_flight.end();
+    for (auto it = network_in_flight.begin(); it != network_in_flight.end(); ++it)
+        if (it->port == port && it->time_us <= VirtualClock::micros() &&
+            (next == network_in_flight.end() || it->time_us < next->time_us))
+            next = it;
+    if (next == network_in_flight.end())
+        return false;
+    *datagram = next->data;
+    network_in_flight.erase(next);
+    return true;
+}
+
+uint8_t WiFiUDP::begin(uint16_t port)
+{
+    this->port_ = port;
+    return 1;
+}
+
+void WiFiUDP::stop()
+{
+    this->port_ = 0;
+}
+
+int WiFiUDP::beginPacket(const char* host, uint16_t port)
+{
+    this->host_        = host;
+    this->remote_port_ = port;
+    this->out_.clear();
+    return 1;
+}
+
+int WiFiUDP::beginPacket(IPAddress address, uint16_t port)
+{
+    uint32_t index = (uint32_t) address - NETWORK_FIRST_ADDRESS;
+    return beginPacket((index < network_hosts.size()) ? network_hosts[index].c_str() : "", port);
+}
+
+size_t WiFiUDP::write(const uint8_t* buffer, size_t size)
+{
+    this->out_.insert(this->out_.end(), buffer, buffer + size);
+    return size;
+}
+
+int WiFiUDP::endPacket()
+{
+    return EmuNetwork::send(this->host_.c_str(), this->remote_port_, this->port_, this->out_) ? 1 : 0;
+}
+
+int WiFiUDP::parsePacket()
+{
+    this->in_pos_ = 0;
+    if (this->port_ == 0 || !EmuNetwork::receive(this->port_, &this->in_))
+    {
+        this->in_.clear();
+        return 0;
+    }
+    return this->in_.size();
+}
+
+int WiFiUDP::read(uint8_t* buffer, size_t len)
+{
+    size_t n = this->in_.size() - this->in_pos_;
+    if (n > len)
+        n = len;
+    memcpy(buffer, this->in_.data() + this->in_pos_, n);
+    this->in_pos_ += n;
+    return n;
+}
+
+void WiFiUDP::flush()
+{
+    this->in_pos_ = this->in_.size();
+}
+
+
+// ----- freertos -----
+
+struct EmuTask
+{
+    TaskFunction_t function;
+    const char*    name;
+    bool           suspended;
+    uint32_t       notifications;
+};
+
+static EmuTask emu_current_task = {NULL, "main", false, 0};
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stack_depth, void* parameters,
+                       UBaseType_t priority, TaskHandle_t* handle)
+{
+    EmuTask* task = new EmuTask{function, name, false, 0};
+    if (handle != NULL)
+        *handle = task;
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stack_depth, void* parameters,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core)
+{
+    return xTaskCreate(function, name, stack_depth, parameters, priority, handle);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    delete task;
+}
+
+void vTaskSuspend(TaskHandle_t task)
+{
+    if (task != NULL)
+        task->suspended = true;
+}
+
+void vTaskResume(TaskHandle_t task)
+{
+    if (task != NULL)
+        task->suspended = false;
+}
+
+void vTaskDelay(const TickType_t ticks)
+{
+    VirtualClock::advance(ticks * portTICK_PERIOD_MS * 1000ULL);
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return millis() / portTICK_PERIOD_MS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return &emu_current_task;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    task->notifications++;
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+    EmuTask* task = &emu_current_task;
+    if (task->notifications == 0)
+    {
+        if (ticks_to_wait != portMAX_DELAY)
+            vTaskDelay(ticks_to_wait);
+        return 0;
+    }
+    uint32_t value = task->notifications;
+    task->notifications = clear_on_exit ? 0 : value - 1;
+    return value;
+}
+
+struct EmuSemaphore
+{
+    std::mutex mutex;
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    return new EmuSemaphore();
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    delete semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    if (ticks_to_wait != portMAX_DELAY)
+        return semaphore->mutex.try_lock() ? pdTRUE : pdFALSE;
+    semaphore->mutex.lock();
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    semaphore->mutex.unlock();
+    return pdTRUE;
+}
+
+
+// ----- neopixelbus -----
+
+static uint8_t toChannel(float value)
+{
+    // the library simply casts, which is undefined for values outside of 0..255 (e.g. for hues > 1.0);
+    // wrap around like the esp32 does instead of relying on what the host compiler makes of it
+    return (uint8_t) (int32_t) (value * 255.0f);
+}
+
+RgbColor::RgbColor(const HsbColor& color)
+{
+    float r, g, b;
+    float h = color.H;
+    float s = color.S;
+    float v = color.B;
+
+    if (color.S == 0.0f)
+    {
+        r = g = b = v;
+    }
+    else
+    {
+        if (h < 0.0f)
+            h += 1.0f;
+        else if (h >= 1.0f)
+            h -= 1.0f;
+        h *= 6.0f;
+        int i = (int) h;
+        float f = h - i;
+        float q = v * (1.0f - s * f);
+        float p = v * (1.0f - s);
+        float t = v * (1.0f - s * (1.0f - f));
+        switch (i)
+        {
+            case 0:  r = v; g = t; b = p; break;
+            case 1:  r = q; g = v; b = p; break;
+            case 2:  r = p; g = v; b = t; break;
+            case 3:  r = p; g = q; b = v; break;
+            case 4:  r = t; g = p; b = v; break;
+            default: r = v; g = p; b = q; break;
+        }
+    }
+    this->R = toChannel(r);
+    this->G = toChannel(g);
+    this->B = toChannel(b);
+}
+
+uint8_t RgbColor::CalculateBrightness() const
+{
+    return (uint8_t) (((uint16_t) this->R + (uint16_t) this->G + (uint16_t) this->B) / 3);
+}
+
+void RgbColor::Darken(uint8_t delta)
+{
+    this->R = (this->R > delta) ? this->R - delta : 0;
+    this->G = (this->G > delta) ? this->G - delta : 0;
+    this->B = (this->B > delta) ? this->B - delta : 0;
+}
+
+void RgbColor::Lighten(uint8_t delta)
+{
+    this->R = (this->R < 255 - delta) ? this->R + delta : 255;
+    this->G = (this->G < 255 - delta) ? this->G + delta : 255;
+    this->B = (this->B < 255 - delta) ? this->B + delta : 255;
+}
+
+RgbColor RgbColor::LinearBlend(const RgbColor& left, const RgbColor& right, float progress)
+{
+    return RgbColor(left.R + ((right.R - left.R) * progress),
+                    left.G + ((right.G - left.G) * progress),
+                    left.B + ((right.B - left.B) * progress));
+}
+
+static std::deque<EmuFrame>  strip_history;
+static size_t                strip_history_limit  = 1024;
+static bool                  strip_wire_time      = true;
+static bool                  strip_force_blocking = false;
+static uint32_t              strip_show_count     = 0;
+static uint64_t              strip_wire_time_us   = 0;
+static uint64_t              strip_blocked_us     = 0;
+static uint64_t              strip_sending_until  = 0;  // virtual time at which the wire is free again
+static EmuLedStrip::ShowHook strip_show_hook;
+
+void EmuLedStrip::transmit(const uint8_t* data, size_t size, bool blocking)
+{
+    uint64_t wire_time = strip_wire_time ? wireTimeUs(size) : 0;
+    if (isSending())
+    {
+        strip_blocked_us += strip_sending_until - VirtualClock::micros();
+        VirtualClock::set(strip_sending_until);
+    }
+    uint64_t now = VirtualClock::micros();
+
+    strip_show_count++;
+    strip_wire_time_us += wire_time;
+    if (strip_history_limit > 0)
+    {
+        if (strip_history.size() >= strip_history_limit)
+            strip_history.pop_front();
+        strip_history.push_back(EmuFrame{now, std::vector<uint8_t>(data, data + size)});
+    }
+    if (strip_show_hook)
+        strip_show_hook(now, data, size);
+
+    strip_sending_until = now + wire_time;
+    if (blocking || strip_force_blocking)
+    {
+        strip_blocked_us += wire_time;
+        VirtualClock::set(strip_sending_until);
+    }
+}
+
+uint64_t EmuLedStrip::wireTimeUs(size_t size)
+{
+    return (size * 8 * 5) / 4 + 50;  // 1.25 us per bit, >= 50 us reset
+}
+
+bool EmuLedStrip::isSending()
+{
+    return VirtualClock::micros() < strip_sending_until;
+}
+
+uint32_t EmuLedStrip::showCount()
+{
+    return strip_show_count;
+}
+
+uint64_t EmuLedStrip::wireTimeTotalUs()
+{
+    return strip_wire_time_us;
+}
+
+uint64_t EmuLedStrip::blockedTimeTotalUs()
+{
+    return strip_blocked_us;
+}
+
+const std::deque<EmuFrame>& EmuLedStrip::history()
+{
+    return strip_history;
+}
+
+void EmuLedStrip::setHistoryLimit(size_t frames)
+{
+    strip_history_limit = frames;
+    while (strip_history.size() > strip_history_limit)
+        strip_history.pop_front();
+}
+
+void EmuLedStrip::setWireTimeEmulation(bool enabled)
+{
+    strip_wire_time = enabled;
+}
+
+void EmuLedStrip::setForceBlocking(bool enabled)
+{
+    strip_force_blocking = enabled;
+}
+
+void EmuLedStrip::setShowHook(ShowHook hook)
+{
+    strip_show_hook = hook;
+}
+
+void EmuLedStrip::reset()
+{
+    strip_history.clear();
+    strip_show_count    = 0;
+    strip_wire_time_us  = 0;
+    strip_blocked_us    = 0;
+    strip_sending_until = 0;
+}
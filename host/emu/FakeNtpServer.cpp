@@ -0,0 +1,118 @@
+#include "FakeNtpServer.h"
+
+#include <WiFiUdp.h>
+
+#include "VirtualClock.h"
+
+
+static const uint64_t NTP_UNIX_OFFSET_SEC = 2208988800ULL;  // 1900-01-01 to 1970-01-01
+
+static void putTimestamp(std::vector<uint8_t>* packet, size_t offset, int64_t unix_us)
+{
+    uint64_t seconds  = unix_us / 1000000 + NTP_UNIX_OFFSET_SEC;
+    uint64_t fraction = ((uint64_t) (unix_us % 1000000) << 32) / 1000000;
+    uint64_t value    = (seconds << 32) | fraction;
+    for (int i = 7; i >= 0; i--, value >>= 8)
+        (*packet)[offset + i] = value & 0xFF;
+}
+
+
+FakeNtpServer::FakeNtpServer(const char* host, uint64_t epoch_us) :
+  epoch_us_(epoch_us),
+  offset_us_(0),
+  drift_ppb_(0),
+  up_us_(0),
+  down_us_(0),
+  jitter_us_(0),
+  loss_percent_(0),
+  reachable_(true),
+  requests_(0),
+  replies_(0),
+  random_(0x9e3779b9)
+{
+    EmuNetwork::addUdpService(host, 123, [this](const std::vector<uint8_t>& request, uint16_t reply_port){
+        this->handle(request, reply_port);
+    });
+}
+
+void FakeNtpServer::setOffset(int64_t offset_us)
+{
+    this->offset_us_ = offset_us;
+}
+
+void FakeNtpServer::setDrift(int32_t drift_ppb)
+{
+    this->drift_ppb_ = drift_ppb;
+}
+
+void FakeNtpServer::setDelay(uint32_t up_us, uint32_t down_us, uint32_t jitter_us)
+{
+    this->up_us_     = up_us;
+    this->down_us_   = down_us;
+    this->jitter_us_ = jitter_us;
+}
+
+void FakeNtpServer::setLoss(uint8_t percent)
+{
+    this->loss_percent_ = percent;
+}
+
+void FakeNtpServer::setReachable(bool reachable)
+{
+    this->reachable_ = reachable;
+}
+
+int64_t FakeNtpServer::timeUs(uint64_t virtual_us) const
+{
+    int64_t slower = (int64_t) ((__int128) virtual_us * this->drift_ppb_ / 1000000000);
+    return this->epoch_us_ + this->offset_us_ + virtual_us - slower;
+}
+
+uint32_t FakeNtpServer::getRequests() const
+{
+    return this->requests_;
+}
+
+uint32_t FakeNtpServer::getReplies() const
+{
+    return this->replies_;
+}
+
+void FakeNtpServer::handle(const std::vector<uint8_t>& request, uint16_t reply_port)
+{
+    this->requests_++;
+    if (request.size() < 48 || (request[0] & 0x07) != 3)  // client mode only
+        return;
+    if (!this->reachable_ || random(100) < this->loss_percent_)
+        return;
+
+    uint64_t now     = VirtualClock::micros();
+    uint64_t arrival = now + this->up_us_ + random(this->jitter_us_ + 1);
+    int64_t  receive = timeUs(arrival);
+    int64_t  send    = receive + 20;  // processing time
+    uint64_t back    = arrival + 20 + this->down_us_ + random(this->jitter_us_ + 1);
+
+    std::vector<uint8_t> reply(48, 0);
+    reply[0] = (0 << 6) | (4 << 3) | 4;  // no leap second, version 4, server mode
+    reply[1] = 1;                        // stratum: primary reference
+    reply[2] = request[2];               // poll
+    reply[3] = (uint8_t) -20;            // precision about 1 us
+    memcpy(&reply[12], "FAKE", 4);       // reference id
+    putTimestamp(&reply, 16, receive);   // reference
+    for (int i = 0; i < 8; i++)
+        reply[24 + i] = request[40 + i]; // originate: the client's transmit timestamp
+    putTimestamp(&reply, 32, receive);
+    putTimestamp(&reply, 40, send);
+
+    this->replies_++;
+    EmuNetwork::deliver(reply_port, back, reply);
+}
+
+uint32_t FakeNtpServer::random(uint32_t below)
+{
+    // xorshift32, reproducible runs
+    this->random_ ^= this->random_ << 13;
+    this->random_ ^= this->random_ >> 17;
+    this->random_ ^= this->random_ << 5;
+    return (below > 0) ? this->random_ % below : 0;
+}
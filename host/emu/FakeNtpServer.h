@@ -0,0 +1,49 @@
+#ifndef __EMU_FAKENTPSERVER_H
+#define __EMU_FAKENTPSERVER_H
+
+#include <stdint.h>
+#include <vector>
+
+// An (S)NTP server on the emulated network, for testing the time service against a clock it knows exactly. Its
+// clock runs 'drift' slower than the device's (the virtual clock), plus an offset that may jump. Requests and
+// replies take the configured delays plus a random jitter; requests may be lost, or the server be unreachable.
+
+class FakeNtpServer
+{
+
+public:
+
+    FakeNtpServer(const char* host, uint64_t epoch_us);  // server time [us since 1970] at virtual time 0
+
+    void setOffset(int64_t offset_us);                  // added to the server time (a jump when changed)
+    void setDrift(int32_t drift_ppb);                   // the device's clock runs fast by this
+    void setDelay(uint32_t up_us, uint32_t down_us, uint32_t jitter_us);
+    void setLoss(uint8_t percent);
+    void setReachable(bool reachable);
+
+    // the server's time [us since 1970] at the given virtual time
+    int64_t timeUs(uint64_t virtual_us) const;
+
+    uint32_t getRequests() const;
+    uint32_t getReplies() const;
+
+private:
+
+    uint64_t epoch_us_;
+    int64_t  offset_us_;
+    int32_t  drift_ppb_;
+    uint32_t up_us_;
+    uint32_t down_us_;
+    uint32_t jitter_us_;
+    uint8_t  loss_percent_;
+    bool     reachable_;
+    uint32_t requests_;
+    uint32_t replies_;
+    uint32_t random_;
+
+    void     handle(const std::vector<uint8_t>& request, uint16_t reply_port);
+    uint32_t random(uint32_t below);
+
+};
+
+#endif  // __EMU_FAKENTPSERVER_H
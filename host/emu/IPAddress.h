@@ -0,0 +1,34 @@
+#ifndef __EMU_IPADDRESS_H
+#define __EMU_IPADDRESS_H
+
+#include <stdint.h>
+
+// An ipv4 address; on the emulated network just a number that WiFi.hostByName() handed out for a host.
+
+class IPAddress
+{
+
+public:
+
+    IPAddress() :
+      address_(0)
+    {
+    }
+
+    IPAddress(uint32_t address) :
+      address_(address)
+    {
+    }
+
+    operator uint32_t() const
+    {
+        return this->address_;
+    }
+
+private:
+
+    uint32_t address_;
+
+};
+
+#endif  // __EMU_IPADDRESS_H
@@ -0,0 +1,78 @@
+#ifndef __EMU_NEOPIXELBRIGHTNESSBUS_H
+#define __EMU_NEOPIXELBRIGHTNESSBUS_H
+
+#include "NeoPixelBus.h"
+
+// Like the library, the brightness is applied when a pixel is set and reverted when it is read back. The buffer
+// only keeps the scaled values, so reading back at low brightness loses precision (exactly as on the device).
+template<typename T_COLOR_FEATURE, typename T_METHOD> class NeoPixelBrightnessBus :
+  public NeoPixelBus<T_COLOR_FEATURE, T_METHOD>
+{
+
+public:
+
+    NeoPixelBrightnessBus(uint16_t count_pixels, uint8_t pin) :
+      NeoPixelBus<T_COLOR_FEATURE, T_METHOD>(count_pixels, pin),
+      brightness_(255)
+    {
+    }
+
+    void SetBrightness(uint8_t brightness)
+    {
+        if (brightness != this->brightness_)
+        {
+            // rescale the existing pixels from the old to the new brightness
+            const uint8_t old_brightness = this->brightness_;
+            for (uint16_t i = 0; i < this->PixelCount(); i++)
+            {
+                this->brightness_ = old_brightness;
+                typename T_COLOR_FEATURE::ColorObject color = this->GetPixelColor(i);
+                this->brightness_ = brightness;
+                this->SetPixelColor(i, color);
+            }
+            this->brightness_ = brightness;
+            this->Dirty();
+        }
+    }
+
+    uint8_t GetBrightness() const
+    {
+        return this->brightness_;
+    }
+
+    void SetPixelColor(uint16_t index, typename T_COLOR_FEATURE::ColorObject color)
+    {
+        scale(&color, this->brightness_ + 1, true);
+        NeoPixelBus<T_COLOR_FEATURE, T_METHOD>::SetPixelColor(index, color);
+    }
+
+    typename T_COLOR_FEATURE::ColorObject GetPixelColor(uint16_t index)
+    {
+        typename T_COLOR_FEATURE::ColorObject color = NeoPixelBus<T_COLOR_FEATURE, T_METHOD>::GetPixelColor(index);
+        scale(&color, this->brightness_ + 1, false);
+        return color;
+    }
+
+    void ClearTo(typename T_COLOR_FEATURE::ColorObject color)
+    {
+        scale(&color, this->brightness_ + 1, true);
+        NeoPixelBus<T_COLOR_FEATURE, T_METHOD>::ClearTo(color);
+    }
+
+private:
+
+    uint8_t brightness_;
+
+    static void scale(typename T_COLOR_FEATURE::ColorObject* color, uint16_t scale, bool dim)
+    {
+        uint8_t* ptr = (uint8_t*) color;
+        for (size_t i = 0; i < T_COLOR_FEATURE::PixelSize; i++, ptr++)
+        {
+            uint16_t value = *ptr;
+            *ptr = dim ? (value * scale) >> 8 : (value << 8) / scale;
+        }
+    }
+
+};
+
+#endif  // __EMU_NEOPIXELBRIGHTNESSBUS_H
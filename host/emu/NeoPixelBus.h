@@ -0,0 +1,229 @@
+#ifndef __EMU_NEOPIXELBUS_H
+#define __EMU_NEOPIXELBUS_H
+
+// Stand-in for "NeoPixelBus" by Makuna. Colors and bus behave like the library (including its dirty flag), but
+// the output method does not drive a pin: every transmitted frame ends up in EmuLedStrip.
+
+#include <Arduino.h>
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+struct HsbColor
+{
+    HsbColor(float h, float s, float b) : H(h), S(s), B(b) {}
+
+    float H;
+    float S;
+    float B;
+};
+
+struct RgbColor
+{
+    RgbColor() : R(0), G(0), B(0) {}
+    RgbColor(uint8_t r, uint8_t g, uint8_t b) : R(r), G(g), B(b) {}
+    explicit RgbColor(uint8_t brightness) : R(brightness), G(brightness), B(brightness) {}
+    RgbColor(const HsbColor& color);
+
+    bool operator==(const RgbColor& other) const { return R == other.R && G == other.G && B == other.B; }
+    bool operator!=(const RgbColor& other) const { return !(*this == other); }
+
+    uint8_t CalculateBrightness() const;
+
+    void Darken(uint8_t delta);
+    void Lighten(uint8_t delta);
+
+    static RgbColor LinearBlend(const RgbColor& left, const RgbColor& right, float progress);
+
+    uint8_t R;
+    uint8_t G;
+    uint8_t B;
+};
+
+
+class NeoGrbFeature
+{
+
+public:
+
+    typedef RgbColor ColorObject;
+
+    static const size_t PixelSize = 3;
+
+    static void applyPixelColor(uint8_t* pixels, uint16_t index, ColorObject color)
+    {
+        uint8_t* p = pixels + index * PixelSize;
+        *p++ = color.G;
+        *p++ = color.R;
+        *p   = color.B;
+    }
+
+    static ColorObject retrievePixelColor(const uint8_t* pixels, uint16_t index)
+    {
+        const uint8_t* p = pixels + index * PixelSize;
+        return ColorObject(p[1], p[0], p[2]);
+    }
+
+};
+
+
+// Collects everything "sent over the wire" by any emulated bus.
+typedef struct
+{
+    uint64_t             time_us;  // virtual time at which the transmission started
+    std::vector<uint8_t> data;     // raw bytes as sent, i.e. in the color order of the feature
+} EmuFrame;
+
+class EmuLedStrip
+{
+
+public:
+
+    typedef std::function<void(uint64_t time_us, const uint8_t* data, size_t size)> ShowHook;
+
+    // Records one frame. A transfer waits for the previous one to leave the wire first. Blocking methods then also
+    // wait for their own one, background methods return right away. Waiting advances the virtual clock.
+    static void transmit(const uint8_t* data, size_t size, bool blocking);
+
+    static uint64_t wireTimeUs(size_t size);  // 800 kbps plus latch time
+
+    static bool isSending();  // a frame is still on the wire
+
+    static uint32_t showCount();
+    static uint64_t wireTimeTotalUs();
+    static uint64_t blockedTimeTotalUs();  // time the senders waited in transmit()
+    static const std::deque<EmuFrame>& history();
+
+    static void setHistoryLimit(size_t frames);   // 0 keeps only the counters
+    static void setWireTimeEmulation(bool enabled);
+    static void setForceBlocking(bool enabled);   // background methods block like bit-banging, for comparisons
+    static void setShowHook(ShowHook hook);
+    static void reset();
+
+};
+
+
+// Output methods. Bit-banging blocks the calling task until the frame is out. The RMT and I2S (DMA) methods start
+// the transfer in the background, so their Update() only waits while the previous frame is still on the wire.
+template<bool BACKGROUND> class EmuOutputMethod
+{
+
+public:
+
+    EmuOutputMethod(uint8_t pin, uint16_t pixel_count, size_t element_size) :
+      pin_(pin),
+      pixels_(pixel_count * element_size, 0)
+    {
+    }
+
+    void Initialize()
+    {
+    }
+
+    bool IsReadyToUpdate() const
+    {
+        return !EmuLedStrip::isSending();
+    }
+
+    void Update()
+    {
+        EmuLedStrip::transmit(pixels_.data(), pixels_.size(), !BACKGROUND);
+    }
+
+    uint8_t* getPixels()
+    {
+        return pixels_.data();
+    }
+
+    size_t getPixelsSize() const
+    {
+        return pixels_.size();
+    }
+
+private:
+
+    uint8_t              pin_;
+    std::vector<uint8_t> pixels_;
+
+};
+
+typedef EmuOutputMethod<false> Neo800KbpsMethod;
+typedef EmuOutputMethod<false> NeoEsp32BitBang800KbpsMethod;
+typedef EmuOutputMethod<true>  NeoEsp32Rmt0800KbpsMethod;
+typedef EmuOutputMethod<true>  NeoEsp32I2s1800KbpsMethod;
+
+
+template<typename T_COLOR_FEATURE, typename T_METHOD> class NeoPixelBus
+{
+
+public:
+
+    NeoPixelBus(uint16_t count_pixels, uint8_t pin) :
+      count_pixels_(count_pixels),
+      dirty_(false),
+      method_(pin, count_pixels, T_COLOR_FEATURE::PixelSize)
+    {
+    }
+
+    void Begin()
+    {
+        this->method_.Initialize();
+        this->Dirty();
+    }
+
+    void Show()
+    {
+        if (!this->IsDirty())
+        {
+            return;
+        }
+        this->method_.Update();
+        this->ResetDirty();
+    }
+
+    bool CanShow() const         { return this->method_.IsReadyToUpdate(); }
+    bool IsDirty() const         { return this->dirty_; }
+    void Dirty()                 { this->dirty_ = true; }
+    void ResetDirty()            { this->dirty_ = false; }
+    uint8_t* Pixels()            { return this->method_.getPixels(); }
+    size_t PixelsSize() const    { return this->method_.getPixelsSize(); }
+    size_t PixelSize() const     { return T_COLOR_FEATURE::PixelSize; }
+    uint16_t PixelCount() const  { return this->count_pixels_; }
+
+    void SetPixelColor(uint16_t index, typename T_COLOR_FEATURE::ColorObject color)
+    {
+        if (index < this->count_pixels_)
+        {
+            T_COLOR_FEATURE::applyPixelColor(this->Pixels(), index, color);
+            this->Dirty();
+        }
+    }
+
+    typename T_COLOR_FEATURE::ColorObject GetPixelColor(uint16_t index)
+    {
+        if (index < this->count_pixels_)
+        {
+            return T_COLOR_FEATURE::retrievePixelColor(this->Pixels(), index);
+        }
+        return typename T_COLOR_FEATURE::ColorObject();
+    }
+
+    void ClearTo(typename T_COLOR_FEATURE::ColorObject color)
+    {
+        for (uint16_t i = 0; i < this->count_pixels_; i++)
+        {
+            T_COLOR_FEATURE::applyPixelColor(this->Pixels(), i, color);
+        }
+        this->Dirty();
+    }
+
+private:
+
+    uint16_t count_pixels_;
+    bool     dirty_;
+    T_METHOD method_;
+
+};
+
+#endif  // __EMU_NEOPIXELBUS_H
@@ -0,0 +1,26 @@
+#ifndef __VIRTUALCLOCK_H
+#define __VIRTUALCLOCK_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Time base of the host emulation. millis(), micros(), delay() and vTaskDelay() are all served from this clock,
+// so the simulation can run the firmware much faster than real time: nothing ever sleeps, every delay just
+// advances the virtual time. The time may be read from other threads (host stress tests).
+class VirtualClock
+{
+
+public:
+
+    static uint64_t micros();
+
+    static void advance(uint64_t us);
+    static void set(uint64_t us);
+
+private:
+
+    static std::atomic<uint64_t> now_us_;
+
+};
+
+#endif  // __VIRTUALCLOCK_H
@@ -0,0 +1,36 @@
+#ifndef __EMU_WIFI_H
+#define __EMU_WIFI_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+typedef enum {
+    WL_IDLE_STATUS     = 0,
+    WL_NO_SSID_AVAIL   = 1,
+    WL_SCAN_COMPLETED  = 2,
+    WL_CONNECTED       = 3,
+    WL_CONNECT_FAILED  = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED    = 6
+} wl_status_t;
+
+class WiFiClass
+{
+
+public:
+
+    wl_status_t status();
+    int         hostByName(const char* host, IPAddress& address);  // 1 if found; blocks on the device
+
+    // emulation only: the simulation decides when the "network" comes up
+    void setStatus(wl_status_t status);
+
+private:
+
+    wl_status_t status_ = WL_DISCONNECTED;
+
+};
+
+extern WiFiClass WiFi;
+
+#endif  // __EMU_WIFI_H
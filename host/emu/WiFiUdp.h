@@ -0,0 +1,68 @@
+#ifndef __EMU_WIFIUDP_H
+#define __EMU_WIFIUDP_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// UDP on an emulated network: datagrams go to services registered with EmuNetwork (e.g. a FakeNtpServer), their
+// replies arrive at the sender's port at a virtual time of the service's choice.
+
+class EmuNetwork
+{
+
+public:
+
+    // called with every datagram sent to the service's host and port; it may answer with deliver()
+    typedef std::function<void(const std::vector<uint8_t>& datagram, uint16_t reply_port)> UdpService;
+
+    static void addUdpService(const char* host, uint16_t port, UdpService service);
+    static void clearUdpServices();
+
+    // for WiFi.hostByName(): false if nobody serves the host (a failed dns lookup); counts the lookups
+    static bool     resolve(const char* host, IPAddress* address);
+    static uint32_t getLookups();
+
+    // the datagram arrives at 'port' at the virtual time 'time_us'
+    static void deliver(uint16_t port, uint64_t time_us, const std::vector<uint8_t>& datagram);
+
+    // for WiFiUDP: false if nobody serves the host (like a failed dns lookup)
+    static bool send(const char* host, uint16_t port, uint16_t from_port, const std::vector<uint8_t>& datagram);
+    // the next datagram that arrived at 'port' by now
+    static bool receive(uint16_t port, std::vector<uint8_t>* datagram);
+
+};
+
+
+class WiFiUDP
+{
+
+public:
+
+    uint8_t begin(uint16_t port);
+    void    stop();
+
+    int    beginPacket(const char* host, uint16_t port);
+    int    beginPacket(IPAddress address, uint16_t port);
+    size_t write(const uint8_t* buffer, size_t size);
+    int    endPacket();
+
+    int  parsePacket();  // size of the next datagram that arrived, 0 if none
+    int  read(uint8_t* buffer, size_t len);
+    void flush();        // drops the rest of the datagram
+
+private:
+
+    uint16_t             port_ = 0;
+    std::string          host_;
+    uint16_t             remote_port_ = 0;
+    std::vector<uint8_t> out_;
+    std::vector<uint8_t> in_;
+    size_t               in_pos_ = 0;
+
+};
+
+#endif  // __EMU_WIFIUDP_H
@@ -0,0 +1,9 @@
+#ifndef __EMU_ESP_TIMER_H
+#define __EMU_ESP_TIMER_H
+
+#include <stdint.h>
+
+// time since boot [us], from the virtual clock
+int64_t esp_timer_get_time();
+
+#endif  // __EMU_ESP_TIMER_H
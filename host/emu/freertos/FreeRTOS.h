@@ -0,0 +1,20 @@
+#ifndef __EMU_FREERTOS_H
+#define __EMU_FREERTOS_H
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int32_t  BaseType_t;
+typedef uint32_t UBaseType_t;
+
+#define portTICK_PERIOD_MS  1
+#define portMAX_DELAY       ((TickType_t) 0xffffffffUL)
+
+#define pdFALSE             ((BaseType_t) 0)
+#define pdTRUE              ((BaseType_t) 1)
+#define pdPASS              pdTRUE
+#define pdFAIL              pdFALSE
+
+#define pdMS_TO_TICKS(ms)   ((TickType_t) (ms) / portTICK_PERIOD_MS)
+
+#endif  // __EMU_FREERTOS_H
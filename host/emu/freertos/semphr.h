@@ -0,0 +1,17 @@
+#ifndef __EMU_FREERTOS_SEMPHR_H
+#define __EMU_FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+// Mutexes only, backed by std::mutex, so they also work between the threads of the host stress tests. A timeout
+// other than portMAX_DELAY is treated as "do not wait".
+
+typedef struct EmuSemaphore* SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+void              vSemaphoreDelete(SemaphoreHandle_t semaphore);
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+#endif  // __EMU_FREERTOS_SEMPHR_H
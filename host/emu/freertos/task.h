@@ -0,0 +1,35 @@
+#ifndef __EMU_FREERTOS_TASK_H
+#define __EMU_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+// Tasks are not scheduled by the emulation. xTaskCreate() only registers them, the simulation drives the task
+// bodies itself (see wordclock_sim.cpp). Delays advance the virtual clock.
+//
+// Everything runs on one emulated "current" task (xTaskGetCurrentTaskHandle()). Task notifications are counted
+// per task; waiting for one returns immediately if there is one pending and otherwise lets the whole timeout pass,
+// as nobody else could notify in between.
+
+typedef void (*TaskFunction_t)(void*);
+
+typedef struct EmuTask* TaskHandle_t;
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stack_depth, void* parameters,
+                       UBaseType_t priority, TaskHandle_t* handle);
+// one core is all there is: the same as xTaskCreate()
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stack_depth, void* parameters,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+
+void vTaskDelete(TaskHandle_t task);
+void vTaskSuspend(TaskHandle_t task);
+void vTaskResume(TaskHandle_t task);
+void vTaskDelay(const TickType_t ticks);
+
+TickType_t xTaskGetTickCount();
+
+TaskHandle_t xTaskGetCurrentTaskHandle();
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t   ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait);
+
+#endif  // __EMU_FREERTOS_TASK_H
@@ -0,0 +1,222 @@
+#include <Arduino.h>
+#include <NeoPixelBus.h>
+#include <WiFi.h>
+
+#include <map>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+#include "golden.h"
+#include "LedMapping.h"
+#include "LedMatrix.h"
+#include "VirtualClock.h"
+#include "WordFrame.h"
+
+
+static const uint8_t  SECONDS_MODES    = 5;                   // LedMatrix::SecondMode
+static const uint16_t MINUTES          = 12 * 60;             // setTime() takes the hour modulo 12
+static const uint32_t PHASES_MS[]      = { 0, 100, 500, 900 };
+static const uint8_t  PHASE_COUNT      = sizeof(PHASES_MS) / sizeof(PHASES_MS[0]);
+static const uint8_t  PPM_SCALE        = 16;                  // pixels per led (the last row and column black)
+static const uint8_t  MAX_DUMPED       = 20;                  // mismatching minutes written as images
+static const uint32_t SPLASH_US        = 10000000;            // longer than any splash screen
+
+typedef struct {
+    uint8_t  mode;
+    uint16_t minute;                 // of the dial, also the second (so every second value turns up)
+    uint64_t hash;                   // of the frames at all phases
+    Frame    frames[PHASE_COUNT];
+} GoldenEntry;
+
+static std::string key(uint8_t mode, uint16_t minute)
+{
+    char text[16];
+    snprintf(text, sizeof(text), "%u %02u:%02u:%02u", mode, minute / 60, minute % 60, minute % 60);
+    return text;
+}
+
+static void hashBytes(uint64_t* hash, const uint8_t* data, size_t size)
+{
+    // FNV-1a
+    for (size_t i = 0; i < size; i++)
+        *hash = (*hash ^ data[i]) * 1099511628211ULL;
+}
+
+Frame timeFrame(uint8_t hour, uint8_t minute, const RgbColor& color)
+{
+    WordFrame words;
+    words.fromTime(hour, minute);
+    Frame frame(LED_CNT * NeoGrbFeature::PixelSize, 0);
+    words.forEachSet([&](uint8_t x, uint8_t y){
+        NeoGrbFeature::applyPixelColor(frame.data(), LedMapping::index(x, y), color);
+    });
+    return frame;
+}
+
+void runLedTask(LedMatrix& led_matrix, uint64_t until_us, uint64_t* next_update_us)
+{
+    while (true)
+    {
+        if (VirtualClock::micros() >= *next_update_us)
+        {
+            uint32_t wait_ms = led_matrix.update();
+            *next_update_us = (wait_ms == LedMatrix::WAIT_FOREVER) ? UINT64_MAX
+                                                                   : VirtualClock::micros() + (wait_ms ? wait_ms : 1) * 1000ULL;
+        }
+        if (VirtualClock::micros() >= until_us)
+            return;
+        uint64_t next = (*next_update_us < until_us) ? *next_update_us : until_us;
+        VirtualClock::advance(next - VirtualClock::micros());
+    }
+}
+
+void runSplashScreen(LedMatrix& led_matrix, uint64_t* next_update_us)
+{
+    runLedTask(led_matrix, VirtualClock::micros() + SPLASH_US, next_update_us);
+}
+
+uint64_t setTimeOnSecond(LedMatrix& led_matrix, uint8_t hour, uint8_t minute, uint8_t second,
+                         uint64_t* next_update_us)
+{
+    uint64_t begin_us = (VirtualClock::micros() / 1000000 + 1) * 1000000;
+    runLedTask(led_matrix, begin_us, next_update_us);
+    led_matrix.setTime(hour, minute, second, begin_us);
+    *next_update_us = VirtualClock::micros();  // woken by setTime()
+    return begin_us;
+}
+
+// Renders the corpus, always the same way in a fresh process: the splash screen first, then per seconds mode every
+// minute for one second, starting on a full second of the virtual clock. The frames of a minute are those on the
+// leds at PHASES_MS, so they include the transition from the minute before, as on the wall.
+static void render(std::vector<GoldenEntry>* entries)
+{
+    Frame shown(LED_CNT * NeoGrbFeature::PixelSize, 0);
+    EmuLedStrip::setHistoryLimit(0);
+    EmuLedStrip::setShowHook([&](uint64_t time_us, const uint8_t* data, size_t size){
+        shown.assign(data, data + size);
+    });
+    WiFi.setStatus(WL_CONNECTED);
+
+    LedMatrix led_matrix;
+    led_matrix.setBrightness(255);  // frames with the colors as rendered, not dimmed
+    led_matrix.setup();
+    led_matrix.setRenderTask(xTaskGetCurrentTaskHandle());
+    uint64_t next_update_us = 0;
+    runSplashScreen(led_matrix, &next_update_us);
+
+    for (uint8_t mode = 0; mode < SECONDS_MODES; mode++)
+    {
+        led_matrix.setSecondsMode(mode);
+        for (uint16_t minute = 0; minute < MINUTES; minute++)
+        {
+            uint64_t begin_us = setTimeOnSecond(led_matrix, minute / 60, minute % 60, minute % 60, &next_update_us);
+
+            GoldenEntry entry;
+            entry.mode   = mode;
+            entry.minute = minute;
+            entry.hash   = 14695981039346656037ULL;
+            for (uint8_t p = 0; p < PHASE_COUNT; p++)
+            {
+                runLedTask(led_matrix, begin_us + PHASES_MS[p] * 1000, &next_update_us);
+                entry.frames[p] = shown;
+                hashBytes(&entry.hash, shown.data(), shown.size());
+            }
+            entries->push_back(entry);
+        }
+    }
+    EmuLedStrip::setShowHook(NULL);
+}
+
+static bool writePpm(const char* path, const Frame& frame)
+{
+    FILE* file = fopen(path, "wb");
+    if (file == NULL)
+        return false;
+    fprintf(file, "P6\n%u %u\n255\n", MATRIX_WIDTH * PPM_SCALE, MATRIX_HEIGHT * PPM_SCALE);
+    for (uint16_t py = 0; py < MATRIX_HEIGHT * PPM_SCALE; py++)
+    {
+        for (uint16_t px = 0; px < MATRIX_WIDTH * PPM_SCALE; px++)
+        {
+            uint8_t  rgb[3] = { 0, 0, 0 };
+            if (px % PPM_SCALE != PPM_SCALE - 1 && py % PPM_SCALE != PPM_SCALE - 1)
+            {
+                const uint8_t* grb = &frame[LedMapping::index(px / PPM_SCALE, py / PPM_SCALE) * 3];
+                rgb[0] = grb[1];
+                rgb[1] = grb[0];
+                rgb[2] = grb[2];
+            }
+            fwrite(rgb, 1, 3, file);
+        }
+    }
+    return fclose(file) == 0;
+}
+
+int verifyGolden(const char* corpus, const char* dump_dir)
+{
+    FILE* file = fopen(corpus, "r");
+    if (file == NULL)
+    {
+        printf("cannot read the golden corpus %s\n", corpus);
+        return 1;
+    }
+    std::map<std::string, uint64_t> golden;
+    char line[64];
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        unsigned mode, h, m, s;
+        unsigned long long hash;
+        if (line[0] != '#' && sscanf(line, "%u %u:%u:%u %llx", &mode, &h, &m, &s, &hash) == 5)
+            golden[key(mode, h * 60 + m)] = hash;
+    }
+    fclose(file);
+
+    std::vector<GoldenEntry> entries;
+    render(&entries);
+
+    unsigned mismatches = 0;
+    for (const GoldenEntry& entry : entries)
+    {
+        auto expected = golden.find(key(entry.mode, entry.minute));
+        if (expected != golden.end() && expected->second == entry.hash)
+            continue;
+        if (mismatches++ >= MAX_DUMPED)
+            continue;
+        mkdir(dump_dir, 0755);
+        printf("mismatch: mode %s%s, frames in %s/\n", key(entry.mode, entry.minute).c_str(),
+               (expected == golden.end()) ? " (not in the corpus)" : "", dump_dir);
+        for (uint8_t p = 0; p < PHASE_COUNT; p++)
+        {
+            char path[256];
+            snprintf(path, sizeof(path), "%s/mode%u_%02u%02u%02u_%03ums.ppm", dump_dir, entry.mode,
+                     entry.minute / 60, entry.minute % 60, entry.minute % 60, PHASES_MS[p]);
+            if (!writePpm(path, entry.frames[p]))
+                printf("cannot write %s\n", path);
+        }
+    }
+    printf("golden frames: %u of %u minutes (%u seconds modes x %u, %u phases each) differ from %s\n",
+           mismatches, (unsigned) entries.size(), SECONDS_MODES, MINUTES, PHASE_COUNT, corpus);
+    return (mismatches == 0) ? 0 : 1;
+}
+
+int updateGolden(const char* corpus)
+{
+    std::vector<GoldenEntry> entries;
+    render(&entries);
+
+    FILE* file = fopen(corpus, "w");
+    if (file == NULL)
+    {
+        printf("cannot write the golden corpus %s\n", corpus);
+        return 1;
+    }
+    fprintf(file, "# golden frames, see host/golden.h: seconds mode, time, FNV-1a hash of the frames on the leds at");
+    for (uint8_t p = 0; p < PHASE_COUNT; p++)
+        fprintf(file, " %u", PHASES_MS[p]);
+    fprintf(file, " ms\n# written by 'make -C host golden', only after the differences were checked\n");
+    for (const GoldenEntry& entry : entries)
+        fprintf(file, "%s %016llx\n", key(entry.mode, entry.minute).c_str(), (unsigned long long) entry.hash);
+    fclose(file);
+    printf("golden frames: wrote %u minutes to %s\n", (unsigned) entries.size(), corpus);
+    return 0;
+}
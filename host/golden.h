@@ -0,0 +1,37 @@
+#ifndef __GOLDEN_H
+#define __GOLDEN_H
+
+#include <NeoPixelBus.h>  // RgbColor
+
+#include <stdint.h>
+#include <vector>
+
+// Golden frame corpus: renders every minute of the 12 hour dial in every seconds mode, captures the frame on the
+// leds at a few fixed phases within the second and hashes them. verifyGolden() compares the hashes with the
+// checked in corpus and writes the frames of the mismatches as PPM images to 'dump_dir'; updateGolden() writes
+// a new corpus (after the differences have been looked at).
+int verifyGolden(const char* corpus, const char* dump_dir);
+int updateGolden(const char* corpus);
+
+// ----- shared with the other checks and the benchmarks -----
+
+class LedMatrix;
+
+typedef std::vector<uint8_t> Frame;  // as sent to the leds, in chain order
+
+// the frame of the time at full brightness, the words in 'color' and everything else black
+Frame timeFrame(uint8_t hour, uint8_t minute, const RgbColor& color);
+
+// runs the led task until the virtual time 'until_us', sleeping as update() asks like taskLED() does; the caller
+// keeps 'next_update_us' (0 at the start, the current time after waking the task with a setter)
+void runLedTask(LedMatrix& led_matrix, uint64_t until_us, uint64_t* next_update_us);
+
+// runs a freshly set up led task through the splash screen
+void runSplashScreen(LedMatrix& led_matrix, uint64_t* next_update_us);
+
+// runs the led task to the next full second of the virtual clock and sets the time there, as loop() does once a
+// second (which wakes the task); returns that second [us]
+uint64_t setTimeOnSecond(LedMatrix& led_matrix, uint8_t hour, uint8_t minute, uint8_t second,
+                         uint64_t* next_update_us);
+
+#endif  // __GOLDEN_H
@@ -0,0 +1,119 @@
+#include <Arduino.h>
+#include <NeoPixelBus.h>
+#include <WiFi.h>
+
+#include <string>
+#include <vector>
+
+#include "FrameMirror.h"
+#include "golden.h"
+#include "LedMapping.h"
+#include "LedMatrix.h"
+#include "mirror_check.h"
+#include "mirror_decoder.h"
+#include "phase_report.h"
+#include "VirtualClock.h"
+
+
+static const uint16_t MINUTES_PER_MODE     = 10;
+static const uint32_t BUDGET_BYTES_PER_MIN = 8192;   // per seconds mode, for the mirror to stay a small load
+
+typedef struct {
+    uint32_t messages;
+    uint32_t keyframes;
+    uint32_t bytes;
+    uint32_t largest;
+    uint32_t mismatches;    // decoded frames that were not the one on the leds
+    uint32_t out_of_sync;   // messages the decoder could not use after a lost one
+} MirrorResult;
+
+static std::vector<uint8_t> leds_rgb(LED_CNT * 3, 0);  // what the leds show, rgb row by row
+
+// runs the led task until 'until_us', polling the mirror every millisecond like taskMQTT(); 'drop' loses the
+// next message on its way to the decoder
+static void run(LedMatrix& led_matrix, uint64_t* next_update_us, FrameMirror& mirror, MirrorDecoder& decoder,
+                uint64_t until_us, MirrorResult* result, bool drop = false)
+{
+    static uint8_t message[FrameMirror::MAX_MESSAGE_SIZE];
+    while (VirtualClock::micros() < until_us)
+    {
+        runLedTask(led_matrix, VirtualClock::micros() + 1000, next_update_us);
+        uint16_t length = mirror.poll(message, sizeof(message));
+        if (length == 0)
+            continue;
+        result->messages++;
+        result->keyframes += (message[0] == FrameMirror::TYPE_KEYFRAME);
+        result->bytes     += length;
+        if (length > result->largest)
+            result->largest = length;
+        if (drop)
+        {
+            drop = false;
+            continue;
+        }
+        MirrorDecoder::Result r = decoder.decode(message, length);
+        if (r == MirrorDecoder::OUT_OF_SYNC)
+            result->out_of_sync++;
+        else if (r != MirrorDecoder::DECODED || decoder.frame() != leds_rgb)
+            result->mismatches++;
+    }
+}
+
+int verifyMirror()
+{
+    EmuLedStrip::setHistoryLimit(0);
+    EmuLedStrip::setShowHook([](uint64_t time_us, const uint8_t* data, size_t size){
+        for (uint16_t p = 0; p < LED_CNT; p++)
+        {
+            const uint8_t* grb = &data[LedMapping::index(p % MATRIX_WIDTH, p / MATRIX_WIDTH) * 3];
+            leds_rgb[p * 3]     = grb[1];
+            leds_rgb[p * 3 + 1] = grb[0];
+            leds_rgb[p * 3 + 2] = grb[2];
+        }
+    });
+    WiFi.setStatus(WL_CONNECTED);
+
+    LedMatrix     led_matrix;
+    FrameMirror   mirror(MQTT_MIRROR_INTERVAL_MS, MQTT_MIRROR_KEYFRAME_SEC * 1000UL);
+    MirrorDecoder decoder(MATRIX_WIDTH, MATRIX_HEIGHT);
+    led_matrix.setup();
+    led_matrix.setRenderTask(xTaskGetCurrentTaskHandle());
+    led_matrix.setFrameMirror(&mirror);
+    PhaseReport phases("frame mirror", 22);
+
+    printf("frame mirror, one message per %u ms at most, a keyframe every %u s, %u bytes per raw frame\n",
+           MQTT_MIRROR_INTERVAL_MS, MQTT_MIRROR_KEYFRAME_SEC, LED_CNT * 3);
+
+    uint64_t     next_update_us = 0;
+    MirrorResult splash         = {0, 0, 0, 0, 0, 0};
+    run(led_matrix, &next_update_us, mirror, decoder, 10000000, &splash);
+    phases.phase("splash screen", splash.mismatches == 0,
+                 "%5u messages %4u keyframes  largest %3u bytes  mismatches %u", splash.messages, splash.keyframes,
+                 splash.largest, splash.mismatches);
+
+    static const char* const MODES[] = { "hidden", "hand", "dot", "decimal", "countdown" };
+    for (uint8_t mode = 0; mode < 5; mode++)
+    {
+        led_matrix.setSecondsMode(mode);
+        MirrorResult result = {0, 0, 0, 0, 0, 0};
+        uint64_t     t      = (VirtualClock::micros() / 1000000 + 1) * 1000000;
+        for (uint16_t second = 0; second < MINUTES_PER_MODE * 60; second++, t += 1000000)
+        {
+            run(led_matrix, &next_update_us, mirror, decoder, t, &result, mode == 2 && second == 30);
+            uint16_t minute = 10 * 60 + mode * MINUTES_PER_MODE + second / 60;
+            led_matrix.setTime(minute / 60, minute % 60, second % 60, t);
+            next_update_us = VirtualClock::micros();  // woken by setTime()
+        }
+        uint32_t per_minute = result.bytes / MINUTES_PER_MODE;
+        bool mode_ok = result.mismatches == 0 && per_minute <= BUDGET_BYTES_PER_MIN &&
+                       (mode != 2 || (result.out_of_sync > 0 && decoder.inSync()));
+        std::string name = std::string("seconds mode ") + MODES[mode];
+        phases.phase(name.c_str(), mode_ok, "%5u bytes/min (raw %6u)  %4u messages %2u keyframes  largest %3u bytes  "
+                     "mismatches %u  resynced after %u",
+                     per_minute, result.messages * LED_CNT * 3 / MINUTES_PER_MODE, result.messages, result.keyframes,
+                     result.largest, result.mismatches, result.out_of_sync);
+    }
+
+    EmuLedStrip::setShowHook(NULL);
+    return phases.finish();
+}
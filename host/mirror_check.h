@@ -0,0 +1,10 @@
+#ifndef __MIRROR_CHECK_H
+#define __MIRROR_CHECK_H
+
+// Runs the clock with a FrameMirror attached, polled like the mqtt task polls it, and decodes every message with
+// the host decoder: each decoded frame must be exactly the one on the leds when the message was made. Also drops
+// a message to see the decoder resync at the next keyframe. Prints the bytes per minute of every seconds mode;
+// returns 0 if all frames matched and the bytes stay within the budget.
+int verifyMirror();
+
+#endif  // __MIRROR_CHECK_H
@@ -0,0 +1,83 @@
+#include "mirror_decoder.h"
+
+
+MirrorDecoder::MirrorDecoder(uint16_t width, uint16_t height) :
+  pixels_(width * height),
+  frame_(width * height * 3, 0),
+  in_sync_(false),
+  sequence_(0)
+{
+}
+
+MirrorDecoder::Result MirrorDecoder::decode(const uint8_t* message, size_t size)
+{
+    if (size < 2)
+        return INVALID;
+    if (message[0] == 'K')
+        return decodeKeyframe(message, size);
+    if (message[0] == 'D')
+        return decodeDelta(message, size);
+    return INVALID;
+}
+
+MirrorDecoder::Result MirrorDecoder::decodeKeyframe(const uint8_t* message, size_t size)
+{
+    if (size < 3)
+        return INVALID;
+    uint8_t colors = message[2];
+    uint8_t bits   = (colors <= 1) ? 0 : (colors <= 2) ? 1 : (colors <= 4) ? 2 : (colors <= 16) ? 4 : 8;
+    const uint8_t* palette = &message[3];
+    const uint8_t* packed  = &palette[colors * 3];
+    if (colors == 0 || size != (size_t) (3 + colors * 3 + (this->pixels_ * bits + 7) / 8))
+        return INVALID;
+
+    for (uint16_t p = 0; p < this->pixels_; p++)
+    {
+        uint32_t bit   = p * bits;
+        uint8_t  index = (bits == 0) ? 0 : (packed[bit / 8] >> (8 - bits - bit % 8)) & ((1 << bits) - 1);
+        if (index >= colors)
+            return INVALID;
+        for (uint8_t c = 0; c < 3; c++)
+            this->frame_[p * 3 + c] = palette[index * 3 + c];
+    }
+    this->sequence_ = message[1];
+    this->in_sync_  = true;
+    return DECODED;
+}
+
+MirrorDecoder::Result MirrorDecoder::decodeDelta(const uint8_t* message, size_t size)
+{
+    if (!this->in_sync_ || message[1] != (uint8_t) (this->sequence_ + 1))
+    {
+        this->in_sync_ = false;  // the delta refers to a frame that was not seen
+        return OUT_OF_SYNC;
+    }
+
+    // checked first, a broken message must not leave half a frame
+    size_t channels = 0;
+    for (size_t pos = 2; pos < size; )
+    {
+        uint8_t token = message[pos++];
+        size_t  n     = (token < 0x80) ? token + 1 : token - 0x7F;
+        if (token >= 0x80)
+            pos += n;
+        channels += n;
+        if (pos > size || channels > this->frame_.size())
+            return INVALID;
+    }
+
+    size_t channel = 0;
+    for (size_t pos = 2; pos < size; )
+    {
+        uint8_t token = message[pos++];
+        if (token < 0x80)
+        {
+            channel += token + 1;
+            continue;
+        }
+        for (uint8_t n = token - 0x7F; n > 0; n--)
+            this->frame_[channel++] ^= message[pos++];
+    }
+    this->sequence_ = message[1];
+    return DECODED;
+}
@@ -0,0 +1,42 @@
+#ifndef __MIRROR_DECODER_H
+#define __MIRROR_DECODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+// Decodes the messages of the frame mirror (see FrameMirror.h for the format) back into the frames the clock
+// showed: r, g, b per pixel, row by row from the top left. Knows nothing but the format and the display size, so
+// it can be taken into a dashboard as it is.
+class MirrorDecoder
+{
+
+public:
+
+    typedef enum {
+        DECODED,      // frame() is the frame of the message
+        OUT_OF_SYNC,  // a message was lost, frame() is the last one decoded until the next keyframe
+        INVALID       // not a message of the mirror
+    } Result;
+
+    MirrorDecoder(uint16_t width, uint16_t height);
+
+    Result decode(const uint8_t* message, size_t size);
+
+    const std::vector<uint8_t>& frame() const { return this->frame_; }
+    bool inSync() const { return this->in_sync_; }
+
+private:
+
+    uint16_t             pixels_;
+    std::vector<uint8_t> frame_;
+    bool                 in_sync_;
+    uint8_t              sequence_;  // of the last message decoded
+
+    Result decodeKeyframe(const uint8_t* message, size_t size);
+    Result decodeDelta(const uint8_t* message, size_t size);
+
+};
+
+#endif  // __MIRROR_DECODER_H
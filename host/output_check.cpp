@@ -0,0 +1,110 @@
+#include <Arduino.h>
+#include <NeoPixelBus.h>
+#include <WiFi.h>
+
+#include <vector>
+
+#include "FrameBuffer.h"
+#include "golden.h"
+#include "LedMatrix.h"
+#include "output_check.h"
+#include "VirtualClock.h"
+
+
+static const uint8_t BRIGHTNESSES[4] = { 1, MATRIX_LED_BRIGHTNESS, 128, 255 };
+
+static int checkTables()
+{
+    // without gamma at full brightness every 8 bit color comes out as it went in; every table runs from 0 to the
+    // brightness and never goes down
+    NeoPixelBus<NeoGrbFeature, Neo800KbpsMethod> bus(LED_CNT, 0);
+    FrameBuffer frame;
+    frame.setGamma(false);
+    uint16_t changed = 0;
+    for (uint16_t c = 0; c < 256; c++)
+    {
+        RgbColor color(c, 255 - c, c / 2);
+        frame.setPixel(0, color);
+        frame.output(bus);
+        changed += (bus.GetPixelColor(0) != color);
+    }
+
+    uint8_t broken = 0;
+    for (bool gamma : { false, true })
+    {
+        frame.setGamma(gamma);
+        for (uint8_t brightness : BRIGHTNESSES)
+        {
+            frame.setBrightness(brightness);
+            uint8_t last = 0;
+            bool    ok   = true;
+            for (uint32_t value = 0; value <= 0xFFFF; value += 0x40)
+            {
+                frame.setPixel(0, FrameBuffer::Color{ (uint16_t) value, 0, 0 });
+                frame.output(bus);
+                ok  &= (bus.GetPixelColor(0).R >= last);
+                last = bus.GetPixelColor(0).R;
+            }
+            frame.setPixel(0, FrameBuffer::Color{ 0, 0xFFFF, 0 });
+            frame.output(bus);
+            ok &= (bus.GetPixelColor(0) == RgbColor(0, brightness, 0));
+            broken += !ok;
+        }
+    }
+    bool ok = (changed == 0 && broken == 0);
+    printf("output tables: %u of 256 colors changed at full brightness without gamma, %u of %u tables not 0 to "
+           "the brightness or not monotonic: %s\n", changed, broken, 2 * (unsigned) sizeof(BRIGHTNESSES),
+           ok ? "ok" : "FAILED");
+    return ok ? 0 : 1;
+}
+
+int verifyOutput()
+{
+    WiFi.setStatus(WL_CONNECTED);
+    EmuLedStrip::setHistoryLimit(0);
+    int failed = checkTables();
+
+    Frame    shown(LED_CNT * NeoGrbFeature::PixelSize, 0);
+    uint32_t frames = 0;
+    EmuLedStrip::setShowHook([&](uint64_t time_us, const uint8_t* data, size_t size){
+        shown.assign(data, data + size);
+        frames++;
+    });
+
+    LedMatrix led_matrix;
+    led_matrix.setBrightness(255);
+    led_matrix.setSecondsMode(LedMatrix::SECONDS_HIDDEN);
+    led_matrix.setTransition(1);  // fade
+    led_matrix.setup();
+    led_matrix.setRenderTask(xTaskGetCurrentTaskHandle());
+    uint64_t next_update_us = 0;
+    runSplashScreen(led_matrix, &next_update_us);
+    uint64_t begin_us = setTimeOnSecond(led_matrix, 10, 0, 0, &next_update_us);
+    runLedTask(led_matrix, begin_us + 1000000, &next_update_us);
+
+    // the brightness goes down and back up: one frame each, the second exactly the time again
+    bool brightness_ok = true;
+    for (uint8_t brightness : { MATRIX_LED_BRIGHTNESS, 255 })
+    {
+        frames = 0;
+        led_matrix.setBrightness(brightness);
+        next_update_us = VirtualClock::micros();
+        runLedTask(led_matrix, VirtualClock::micros() + 500000, &next_update_us);
+        brightness_ok &= (frames == 1) && (shown == timeFrame(10, 0, RgbColor(brightness)));
+    }
+    printf("brightness 255 -> %u -> 255: one frame each, the time as before: %s\n", MATRIX_LED_BRIGHTNESS,
+           brightness_ok ? "ok" : "FAILED");
+    failed |= !brightness_ok;
+
+    // a new word color: the words fade to it, the rest stays black
+    frames = 0;
+    led_matrix.setWordColor(255, 0, 0);
+    next_update_us = VirtualClock::micros();
+    runLedTask(led_matrix, VirtualClock::micros() + 500000, &next_update_us);
+    bool color_ok = (frames > 1) && (shown == timeFrame(10, 0, RgbColor(255, 0, 0)));
+    printf("word color white -> red: %u frames, then red words: %s\n", frames, color_ok ? "ok" : "FAILED");
+    failed |= !color_ok;
+
+    EmuLedStrip::setShowHook(NULL);
+    return failed;
+}
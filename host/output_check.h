@@ -0,0 +1,9 @@
+#ifndef __OUTPUT_CHECK_H
+#define __OUTPUT_CHECK_H
+
+// Checks the output stage (see FrameBuffer.h): the brightness x gamma tables, that a change of the brightness only
+// changes the output (the time is back exactly when it returns, without a transition), and that the words fade
+// to a new word color. Returns 0 if all of it holds.
+int verifyOutput();
+
+#endif  // __OUTPUT_CHECK_H
@@ -0,0 +1,40 @@
+#include "phase_report.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+
+PhaseReport::PhaseReport(const char* check, uint8_t name_width) :
+  check_(check),
+  name_width_(name_width),
+  ok_(true)
+{
+}
+
+bool PhaseReport::phase(const char* name, bool ok, const char* format, ...)
+{
+    printf("%-*s ", this->name_width_, name);
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    printf("  %s\n", ok ? "ok" : "FAILED");
+    this->ok_ = this->ok_ && ok;
+    return ok;
+}
+
+void PhaseReport::note(const char* format, ...)
+{
+    printf("%-*s ", this->name_width_, "");
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    printf("\n");
+}
+
+int PhaseReport::finish() const
+{
+    printf("%s %s\n", this->check_, this->ok_ ? "ok" : "FAILED");
+    return this->ok_ ? 0 : 1;
+}
@@ -0,0 +1,32 @@
+#ifndef __PHASE_REPORT_H
+#define __PHASE_REPORT_H
+
+#include <stdint.h>
+
+// The output of a check that runs in phases (time service, pixel stream, frame mirror): a line per phase with its
+// name, what it saw and its verdict, and at the end the verdict of the whole check, which fails if any phase did.
+class PhaseReport
+{
+
+public:
+
+    PhaseReport(const char* check, uint8_t name_width);
+
+    // prints the line of a phase, the details formatted like printf(); returns 'ok'
+    bool phase(const char* name, bool ok, const char* format, ...) __attribute__((format(printf, 4, 5)));
+
+    // a further line about the last phase, its text below the details
+    void note(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    // prints the verdict of the check; returns 0 if every phase was ok, as the exit code of the check
+    int finish() const;
+
+private:
+
+    const char* check_;
+    uint8_t     name_width_;
+    bool        ok_;
+
+};
+
+#endif  // __PHASE_REPORT_H
@@ -0,0 +1,315 @@
+#include <Arduino.h>
+#include <NeoPixelBus.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "golden.h"
+#include "LedMapping.h"
+#include "LedMatrix.h"
+#include "phase_report.h"
+#include "PixelStream.h"
+#include "Prng.h"
+#include "stream_check.h"
+#include "VirtualClock.h"
+#include "WordFrame.h"
+
+
+typedef struct {
+    uint64_t time_us;
+    Frame    data;
+} Shown;
+
+typedef struct {
+    uint64_t time_us;                // of the arrival at the device
+    std::vector<uint8_t> data;
+} Datagram;
+
+// what a phase sent and what the leds showed of it
+typedef struct {
+    std::vector<Datagram>        datagrams;
+    std::map<uint16_t, uint64_t> pushed;        // frames that should be shown: arrival of their push packet
+} Phase;
+
+typedef struct {
+    uint32_t shown;                  // sent frames that were on the leds
+    uint32_t foreign;                // frames on the leds that were not exactly a sent one, or older than the last
+    uint32_t first_latency_us;       // of the first frame shown
+    std::vector<uint32_t> latency_us;  // of the others, from the arrival of the push packet to Show()
+    uint32_t dropped;
+    uint32_t lost;
+} PhaseResult;
+
+
+// Sends frames like a light controller: a frame split into packets of about equal size, the last one with the push
+// flag, every packet numbered. The colors of a frame are a function of its number, which is also in the first
+// pixel, so a frame on the leds tells which one it is.
+class DdpSender
+{
+
+public:
+
+    static const uint8_t FLAGS_V1       = 0x40;
+    static const uint8_t FLAG_TIMECODE  = 0x10;
+    static const uint8_t FLAG_QUERY     = 0x02;
+    static const uint8_t FLAG_PUSH      = 0x01;
+    static const uint8_t TYPE_RGB8      = 0x0B;
+    static const uint8_t ID_DISPLAY     = 1;
+
+    DdpSender() : sequence_(0) {}
+
+    // the packets of frame 'frame', the first one arriving at 'time_us', the others 'spacing_us' apart
+    void frame(Phase* phase, uint16_t frame, uint8_t parts, uint64_t time_us, uint32_t spacing_us, bool timecode)
+    {
+        uint16_t pixels_per_part = (LED_CNT + parts - 1) / parts;
+        for (uint8_t part = 0; part < parts; part++)
+        {
+            uint16_t first = part * pixels_per_part;
+            uint16_t count = std::min<uint16_t>(pixels_per_part, LED_CNT - first);
+            bool     push  = (part == parts - 1);
+            this->sequence_ = this->sequence_ % 15 + 1;
+
+            Datagram d;
+            d.time_us = time_us + part * spacing_us;
+            header(&d.data, FLAGS_V1 | (timecode ? FLAG_TIMECODE : 0) | (push ? FLAG_PUSH : 0), this->sequence_,
+                   TYPE_RGB8, ID_DISPLAY, first * 3, count * 3);
+            if (timecode)
+            {
+                d.data.insert(d.data.end(), 4, 0);
+            }
+            for (uint16_t p = first; p < first + count; p++)
+            {
+                RgbColor c = color(frame, p);
+                d.data.push_back(c.R);
+                d.data.push_back(c.G);
+                d.data.push_back(c.B);
+            }
+            phase->datagrams.push_back(d);
+            if (push)
+            {
+                phase->pushed[frame] = d.time_us;
+            }
+        }
+    }
+
+    static void header(std::vector<uint8_t>* data, uint8_t flags, uint8_t sequence, uint8_t type, uint8_t id,
+                       uint32_t offset, uint16_t length)
+    {
+        uint8_t h[10] = { flags, sequence, type, id, (uint8_t) (offset >> 24), (uint8_t) (offset >> 16),
+                          (uint8_t) (offset >> 8), (uint8_t) offset, (uint8_t) (length >> 8), (uint8_t) length };
+        data->insert(data->end(), h, h + sizeof(h));
+    }
+
+    static RgbColor color(uint16_t frame, uint16_t pixel)
+    {
+        if (pixel == 0)
+            return RgbColor(frame >> 8, frame & 0xFF, 0x5A);
+        return RgbColor(frame * 7 + pixel * 3, frame * 13 + pixel * 5, frame + pixel * 11);
+    }
+
+    // the frame on the leds that shows 'frame'
+    static Frame expected(uint16_t frame)
+    {
+        Frame leds(LED_CNT * 3, 0);
+        for (uint16_t p = 0; p < LED_CNT; p++)
+        {
+            RgbColor c = color(frame, p);
+            uint8_t* grb = &leds[LedMapping::index(p % MATRIX_WIDTH, p / MATRIX_WIDTH) * 3];
+            grb[0] = c.G;
+            grb[1] = c.R;
+            grb[2] = c.B;
+        }
+        return leds;
+    }
+
+private:
+
+    uint8_t sequence_;
+
+};
+
+
+static std::vector<Shown> shown;
+
+static PhaseResult run(LedMatrix& led_matrix, uint64_t* next_update_us, PixelStream& stream, const Phase& phase,
+                       uint64_t until_us)
+{
+    uint32_t dropped = stream.getDropped();
+    uint32_t lost    = stream.getLost();
+    for (const Datagram& d : phase.datagrams)
+    {
+        EmuNetwork::deliver(PixelStream::DDP_PORT, d.time_us, d.data);
+    }
+    shown.clear();
+    runLedTask(led_matrix, until_us, next_update_us);
+
+    PhaseResult result = {0, 0, 0, {}, stream.getDropped() - dropped, stream.getLost() - lost};
+    int32_t last = -1;
+    for (const Shown& s : shown)
+    {
+        const uint8_t* grb   = &s.data[LedMapping::index(0, 0) * 3];
+        uint16_t       frame = (grb[1] << 8) | grb[0];
+        auto           push  = phase.pushed.find(frame);
+        if (push == phase.pushed.end() || (int32_t) frame <= last || s.data != DdpSender::expected(frame))
+        {
+            result.foreign++;
+            continue;
+        }
+        last = frame;
+        if (result.shown++ == 0)
+            result.first_latency_us = s.time_us - push->second;
+        else
+            result.latency_us.push_back(s.time_us - push->second);
+    }
+    return result;
+}
+
+static void report(PhaseReport& phases, const char* name, PhaseResult& r, const Phase& phase, uint32_t dropped,
+                   uint32_t lost, bool first)
+{
+    std::sort(r.latency_us.begin(), r.latency_us.end());
+    uint64_t sum = 0;
+    for (uint32_t l : r.latency_us)
+        sum += l;
+    uint32_t n   = r.latency_us.size();
+    uint32_t p99 = n ? r.latency_us[(n * 99 + 99) / 100 - 1] : 0;
+    uint32_t max = n ? r.latency_us.back() : 0;
+    bool ok = r.shown == phase.pushed.size() && r.foreign == 0 && r.dropped == dropped && r.lost == lost &&
+              max <= PixelStream::POLL_MS * 1000 &&
+              r.first_latency_us <= (first ? PixelStream::IDLE_POLL_MS : PixelStream::POLL_MS) * 1000;
+    phases.phase(name, ok, "shown %3u/%3u  foreign %u  dropped %2u  lost %2u  latency avg %4.0f p99 %4u max %4u us  "
+                 "first %5u us",
+                 r.shown, (unsigned) phase.pushed.size(), r.foreign, r.dropped, r.lost, n ? (double) sum / n : 0.0,
+                 p99, max, r.first_latency_us);
+}
+
+int verifyStream()
+{
+    EmuNetwork::clearUdpServices();
+    EmuLedStrip::setHistoryLimit(0);
+    EmuLedStrip::setShowHook([](uint64_t time_us, const uint8_t* data, size_t size){
+        shown.push_back(Shown{time_us, Frame(data, data + size)});
+    });
+    WiFi.setStatus(WL_CONNECTED);
+
+    LedMatrix   led_matrix;
+    PixelStream stream(PixelStream::DDP_PORT, STREAM_TIMEOUT_MS);
+    led_matrix.setBrightness(255);  // the colors as sent
+    led_matrix.setSecondsMode(LedMatrix::SECONDS_HIDDEN);
+    led_matrix.setup();
+    led_matrix.setRenderTask(xTaskGetCurrentTaskHandle());
+    stream.begin();
+    led_matrix.setPixelStream(&stream);
+
+    uint64_t next_update_us = 0;
+    runSplashScreen(led_matrix, &next_update_us);
+    uint64_t t = setTimeOnSecond(led_matrix, 10, 0, 0, &next_update_us);
+    t += 2000000;
+    runLedTask(led_matrix, t, &next_update_us);        // the clock is on
+
+    printf("pixel stream over DDP (virtual time: polling, frame rate limit and wire, not cpu time)\n");
+    DdpSender   sender;
+    Prng        prng(42);
+    PhaseReport phases("pixel stream", 36);
+
+    // whole frames with up to 3 ms of jitter, and invalid datagrams in between
+    Phase a;
+    uint16_t frame = 0;
+    for (uint16_t i = 0; i < 400; i++, frame++)
+    {
+        sender.frame(&a, frame, 1, t + i * 25000 + prng.below(3000), 0, false);
+    }
+    const uint8_t invalid[][4] = { // flags, type, id, offset
+        { DdpSender::FLAGS_V1 | DdpSender::FLAG_QUERY, DdpSender::TYPE_RGB8, DdpSender::ID_DISPLAY, 0 },
+        { 0x80 | DdpSender::FLAG_PUSH,                 DdpSender::TYPE_RGB8, DdpSender::ID_DISPLAY, 0 },
+        { DdpSender::FLAGS_V1 | DdpSender::FLAG_PUSH,  DdpSender::TYPE_RGB8, 2,                     0 },
+        { DdpSender::FLAGS_V1 | DdpSender::FLAG_PUSH,  0x1B,                 DdpSender::ID_DISPLAY, 0 },
+        { DdpSender::FLAGS_V1 | DdpSender::FLAG_PUSH,  DdpSender::TYPE_RGB8, DdpSender::ID_DISPLAY, 4 } };
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        Datagram d;
+        d.time_us = t + 1000000 + i * 1000000 + 12000;
+        DdpSender::header(&d.data, invalid[i][0], 0, invalid[i][1], invalid[i][2], invalid[i][3], 3);
+        d.data.insert(d.data.end(), 3, 0xFF);
+        a.datagrams.push_back(d);
+    }
+    Datagram runt;
+    runt.time_us = t + 6000000 + 12000;
+    runt.data.assign(4, DdpSender::FLAGS_V1);
+    a.datagrams.push_back(runt);
+    PhaseResult r = run(led_matrix, &next_update_us, stream, a, t + 400 * 25000);
+    report(phases, "40 fps, whole frames, 6 invalid", r, a, 6, 0, true);
+    t += 400 * 25000;
+
+    // split into 3 packets with timecodes
+    Phase b;
+    for (uint16_t i = 0; i < 600; i++, frame++)
+    {
+        sender.frame(&b, frame, 3, t + i * 16667, 300, true);
+    }
+    r = run(led_matrix, &next_update_us, stream, b, t + 600 * 16667);
+    report(phases, "60 fps, 3 packets a frame", r, b, 0, 0, false);
+    t += 600 * 16667;
+
+    // every 10th push packet twice, 4 frames arriving after the next one, 3 push packets lost
+    Phase c;
+    const std::set<uint16_t> late = { 50, 150, 250, 350 };
+    const std::set<uint16_t> lost = { 100, 201, 302 };
+    for (uint16_t i = 0; i < 400; i++, frame++)
+    {
+        Phase f;
+        sender.frame(&f, frame, 2, t + i * 25000, 300, false);
+        if (late.count(i))
+        {
+            for (Datagram& d : f.datagrams)
+                d.time_us += 30000;
+            f.pushed.clear();
+        }
+        if (lost.count(i))
+        {
+            f.datagrams.pop_back();
+            f.pushed.clear();
+        }
+        if (i % 10 == 3)
+        {
+            f.datagrams.push_back(f.datagrams.back());
+            f.datagrams.back().time_us += 500;
+        }
+        c.datagrams.insert(c.datagrams.end(), f.datagrams.begin(), f.datagrams.end());
+        c.pushed.insert(f.pushed.begin(), f.pushed.end());
+    }
+    r = run(led_matrix, &next_update_us, stream, c, t + 400 * 25000);
+    report(phases, "40 fps, duplicated, late and lost", r, c, 40 + 2 * late.size(), 2 * late.size() + lost.size(),
+           false);
+    uint64_t last_us = t + 399 * 25000 + 300;
+
+    // the controller stops: after the timeout the clock comes back (in time for the slowest transition)
+    Phase none;
+    run(led_matrix, &next_update_us, stream, none, last_us + STREAM_TIMEOUT_MS * 1000 + 5000000);
+    WordFrame words;
+    words.fromTime(10, 0);
+    uint32_t wrong = 0;
+    const Frame& leds = shown.empty() ? Frame(LED_CNT * 3, 0) : shown.back().data;
+    for (uint8_t y = 0; y < MATRIX_HEIGHT; y++)
+    {
+        for (uint8_t x = 0; x < MATRIX_WIDTH; x++)
+        {
+            const uint8_t* grb = &leds[LedMapping::index(x, y) * 3];
+            bool lit = grb[0] != 0 || grb[1] != 0 || grb[2] != 0;
+            if (lit != words.isSet(x, y))
+                wrong++;
+        }
+    }
+    uint64_t back_us = shown.empty() ? 0 : shown.front().time_us - last_us;
+    bool back_ok = !shown.empty() && wrong == 0 && back_us >= STREAM_TIMEOUT_MS * 1000ULL &&
+                   back_us <= (STREAM_TIMEOUT_MS + PixelStream::POLL_MS + 1000 / MATRIX_MAX_FPS) * 1000ULL;
+    phases.phase("stream stops", back_ok, "clock again %4llu ms after the last packet, %u pixels wrong",
+                 (unsigned long long) back_us / 1000, wrong);
+
+    EmuLedStrip::setShowHook(NULL);
+    return phases.finish();
+}
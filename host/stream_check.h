@@ -0,0 +1,10 @@
+#ifndef __STREAM_CHECK_H
+#define __STREAM_CHECK_H
+
+// Streams DDP frames to the LedMatrix over the emulated network, in virtual time: whole frames at 40 fps, frames
+// split over several packets at 60 fps, duplicated, late and lost packets, invalid datagrams, and the end of the
+// stream. Checks that every frame on the leds is exactly one that was sent, in order, and measures the latency
+// from the arrival of a frame's push packet to its Show(). Returns 0 if all phases are within their limits.
+int verifyStream();
+
+#endif  // __STREAM_CHECK_H
@@ -0,0 +1,160 @@
+#include <Arduino.h>
+#include <FakeNtpServer.h>
+#include <WiFiUdp.h>
+
+#include <functional>
+#include <stdlib.h>
+
+#include "phase_report.h"
+#include "time_check.h"
+#include "TimeService.h"
+#include "VirtualClock.h"
+
+
+static const uint64_t EPOCH_US       = 1700000000ULL * 1000000;  // 2023-11-14
+static const int32_t  DRIFT_PPB      = 40000;                    // the device's crystal runs 40 ppm fast
+static const uint32_t SYNC_INTERVAL  = 300000;                   // [ms], as TIME_SYNC_INTERVAL_SEC
+static const int64_t  ROLLOVER_US    = 2085978496LL * 1000000;   // 2036-02-07 06:28:16, ntp era 1 begins
+
+// what the clock showed against the truth during a phase
+typedef struct {
+    int64_t  last_error_us;
+    int64_t  max_error_us;   // in the last quarter of the phase
+    uint32_t rate_faults;    // seconds that took more or less than SLEW_PPM + MAX_DRIFT_PPB allow
+    uint32_t boundaries;     // seconds looked at where currentSecond() said they begin
+    uint32_t boundary_faults;
+} PhaseResult;
+
+static const char* const SERVERS[] = { "ntp-a.test", "ntp-b.test", "ntp-dead.test" };
+
+static PhaseResult run(TimeService& service, FakeNtpServer& truth, uint32_t seconds)
+{
+    PhaseResult result = {0, 0, 0, 0, 0};
+    const int64_t tolerance_ppm = TimeService::SLEW_PPM + TimeService::MAX_DRIFT_PPB / 1000 + 100;
+    uint64_t stop_us  = VirtualClock::micros() + seconds * 1000000ULL;
+    uint64_t quarter  = stop_us - seconds * 250000ULL;
+    uint64_t next_us  = VirtualClock::micros();
+    int64_t  last_utc = 0;
+    uint64_t last_v   = 0;
+    bool     had_time = false;
+    uint64_t boundary = 0;   // where the service said the next second begins
+    while (VirtualClock::micros() < stop_us)
+    {
+        if (VirtualClock::micros() >= next_us)
+        {
+            next_us += service.update() * 1000ULL;
+            boundary = 0;  // a sync may have changed the clock since the boundary was told
+        }
+
+        uint64_t v = VirtualClock::micros();
+        struct timeval tv;
+        if (service.now(&tv))
+        {
+            int64_t utc   = tv.tv_sec * 1000000LL + tv.tv_usec;
+            int64_t error = utc - truth.timeUs(v);
+            result.last_error_us = error;
+            if (v >= quarter && llabs(error) > result.max_error_us)
+                result.max_error_us = llabs(error);
+            if (had_time && v > last_v)
+            {
+                int64_t deviation = (utc - last_utc) - (int64_t) (v - last_v);
+                if (llabs(deviation) > 1 + tolerance_ppm * (int64_t) (v - last_v) / 1000000)  // 1: rounding
+                    result.rate_faults++;
+            }
+            if (v == boundary)
+            {
+                result.boundaries++;
+                if (tv.tv_usec > 1 && tv.tv_usec < 999999)  // 1: rounding
+                    result.boundary_faults++;
+            }
+            last_utc = utc;
+            last_v   = v;
+            had_time = true;
+        }
+
+        // one look at the clock per second, like loop(): at the next second of the service, before the first sync
+        // at the next full second of the local clock; earlier if the service wants to run
+        time_t  second;
+        int64_t  begin_us, end_us;
+        uint64_t step = 1000000 - v % 1000000;
+        if (service.currentSecond(&second, &begin_us, &end_us))
+        {
+            boundary = end_us;
+            step     = end_us - v;
+        }
+        if (next_us > v && next_us - v < step)
+            step = next_us - v;
+        VirtualClock::advance((step > 0) ? step : 1);
+    }
+    return result;
+}
+
+static void report(PhaseReport& phases, const char* phase, const PhaseResult& r, const TimeService& service,
+                   int64_t max_error_us, bool allow_steps, bool ok)
+{
+    ok = ok && r.max_error_us <= max_error_us && (allow_steps || r.rate_faults == 0) && r.boundary_faults == 0;
+    phases.phase(phase, ok, "error %7.3f ms (max %7.3f ms)  drift %+7.3f ppm  failures %3u  retry %5u s  steps %u  "
+                 "seconds off %u/%u",
+                 r.last_error_us / 1000.0, r.max_error_us / 1000.0, service.getDriftPpb() / 1000.0,
+                 service.getFailures(), service.getRetryMs() / 1000, r.rate_faults, r.boundary_faults, r.boundaries);
+}
+
+int verifyTime()
+{
+    VirtualClock::set(1000000);
+    EmuNetwork::clearUdpServices();
+    FakeNtpServer a(SERVERS[0], EPOCH_US);
+    FakeNtpServer b(SERVERS[1], EPOCH_US);
+    auto both = [&](std::function<void(FakeNtpServer&)> func){ func(a); func(b); };
+    both([](FakeNtpServer& s){ s.setDrift(DRIFT_PPB); s.setDelay(20000, 20000, 1000); });
+
+    TimeService service(SERVERS, 3, SYNC_INTERVAL);
+    service.begin();
+    uint32_t lookups = EmuNetwork::getLookups();
+    PhaseReport phases("time service", 34);
+    PhaseResult r;
+
+    printf("time service against fake ntp servers (device %d ppm fast, 20 ms delay each way, 1 ms jitter)\n",
+           DRIFT_PPB / 1000);
+
+    r = run(service, a, 2 * 3600);
+    lookups = EmuNetwork::getLookups() - lookups;
+    report(phases, "first sync, drift estimation", r, service, 2000, true,
+           service.isSynced() && abs(service.getDriftPpb() + DRIFT_PPB) <= 5000 && lookups == 1);
+    phases.note("%u dns lookups for %u requests", lookups, a.getRequests());
+
+    both([](FakeNtpServer& s){ s.setOffset(300000); });
+    r = run(service, a, 3600);
+    report(phases, "300 ms jump, slewed", r, service, 2000, false,
+           abs(service.getDriftPpb() + DRIFT_PPB) <= 5000);
+
+    both([](FakeNtpServer& s){ s.setReachable(false); });
+    uint32_t requests = a.getRequests() + b.getRequests();
+    r = run(service, a, 3 * 3600);
+    requests = a.getRequests() + b.getRequests() - requests;
+    report(phases, "unreachable for 3 h, backoff", r, service, 20000, false,
+           service.getRetryMs() == TimeService::RETRY_MAX_MS && requests < 20);
+    phases.note("%u requests to the servers in 3 h", requests);
+
+    both([](FakeNtpServer& s){ s.setReachable(true); });
+    r = run(service, a, 2 * 3600);
+    report(phases, "reachable again", r, service, 2000, false, service.getFailures() == 0);
+
+    both([](FakeNtpServer& s){ s.setLoss(60); });
+    r = run(service, a, 2 * 3600);
+    report(phases, "60 % loss", r, service, 3000, false, true);
+
+    both([](FakeNtpServer& s){ s.setLoss(0); s.setOffset(5300000); });
+    r = run(service, a, 1800);
+    report(phases, "5 s jump, stepped", r, service, 2000, true, r.rate_faults == 1);
+
+    // the servers half an hour before the ntp seconds wrap, then across it
+    int64_t to_rollover = ROLLOVER_US - 1800000000LL - a.timeUs(VirtualClock::micros());
+    both([&](FakeNtpServer& s){ s.setOffset(5300000 + to_rollover); });
+    r = run(service, a, 3600);
+    struct timeval tv;
+    report(phases, "2036, ntp era 1", r, service, 2000, true,
+           r.rate_faults == 1 && service.now(&tv) && tv.tv_sec * 1000000LL > ROLLOVER_US);
+
+    return phases.finish();
+}
@@ -0,0 +1,9 @@
+#ifndef __TIME_CHECK_H
+#define __TIME_CHECK_H
+
+// Runs the TimeService against FakeNtpServers on the emulated network, in virtual time: drift estimation,
+// slewing of an offset jump, packet loss, backoff while the servers are unreachable, recovery and a large step.
+// Prints the figures of every phase; returns 0 if all of them are within their limits.
+int verifyTime();
+
+#endif  // __TIME_CHECK_H
@@ -0,0 +1,415 @@
+// Host simulation of the word clock: runs the firmware's LED task and main loop against the emulated
+// Arduino/ESP32 layer on a virtual clock, so a whole day of splash, transitions and seconds modes
+// replays in seconds and can be profiled with ordinary host tools.
+
+#include <Arduino.h>
+#include <NeoPixelBus.h>
+#include <WiFi.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "VirtualClock.h"
+#include "LedMapping.h"
+#include "LedMatrix.h"
+#include "benchmarks.h"
+#include "CommandRouter.h"
+#include "effect_asm.h"
+#include "effect_check.h"
+#include "golden.h"
+#include "mirror_check.h"
+#include "output_check.h"
+#include "Profiler.h"
+#include "stream_check.h"
+#include "time_check.h"
+
+
+typedef struct
+{
+    uint32_t start_sec;       // wall clock time of day at which the simulation starts
+    uint32_t duration_sec;    // simulated time span
+    uint32_t wifi_ms;         // time until the emulated wifi reports to be connected
+    uint32_t task_delay;      // 0: led task sleeps until update()'s deadline, else fixed ticks per loop (vTaskDelay)
+    int      seconds_mode;    // -1: keep firmware default
+    int      splash;          // -1: keep firmware default
+    bool     wire_time;       // account for the time the frames take on the wire
+    bool     blocking_output; // send like the bit-banging method, whatever MATRIX_LED_OUTPUT is
+    size_t   history;         // number of frames to keep in the emulated strip history
+    bool     verbose;         // print a status line per simulated hour
+    bool     verify_masks;    // only compare the precomputed word masks with the minute rules
+    bool     verify_mapping;  // only check the led mapping table
+    bool     verify_time;     // only run the time service against fake ntp servers
+    bool     verify_stream;   // only stream ddp frames to the matrix
+    bool     verify_mirror;   // only decode the frame mirror's messages
+    bool     verify_output;   // only check the output stage
+    const char* verify_effects; // only check the uploadable effects of this directory
+    const char* verify_golden;  // only compare the rendered frames with this golden corpus
+    const char* update_golden;  // only write a new golden corpus
+    const char* golden_dump;    // where the frames of golden mismatches go
+    const char* bench;        // only run the given micro benchmark
+    const char* assemble_in;    // only assemble this effect ...
+    const char* assemble_out;   // ... into this file
+    const char* router_seed;    // only find the seed of a CommandRouter for these command names
+} Options;
+
+static void usage(const char* name)
+{
+    printf("usage: %s [options]\n"
+           "  --start HH:MM:SS      time of day to start at (default 00:00:00)\n"
+           "  --hours N             simulated duration in hours (default 24)\n"
+           "  --seconds-mode N      0=hidden 1=hand 2=dot 3=decimal 4=countdown (default: firmware default)\n"
+           "  --splash N            splash screen index (default: firmware default)\n"
+           "  --wifi-ms N           virtual ms until wifi is connected (default 3000)\n"
+           "  --task-delay N        poll update() every N ticks instead of sleeping until it is due (default 0)\n"
+           "  --no-wire-time        do not account for the transfer time of Show()\n"
+           "  --blocking-output     let Show() block for the whole transfer, like the bit-banging output method\n"
+           "  --history N           frames kept in the emulated led history (default 1024)\n"
+           "  --verbose             print statistics for every simulated hour\n"
+           "  --verify-masks        check the word masks of all 720 times against the minute rules and exit\n"
+           "  --verify-mapping      check that the led mapping table maps every led exactly once and exit\n"
+           "  --verify-time         run the ntp time service against fake servers (delay, loss, offsets) and exit\n"
+           "  --verify-stream       stream DDP frames to the matrix (split, late, lost), measure the latency and exit\n"
+           "  --verify-mirror       decode the frame mirror's messages against the leds, report bytes/min and exit\n"
+           "  --verify-output       check brightness, gamma and word color of the output stage and exit\n"
+           "  --verify-effects DIR  check the verifier and the effects (*.fxa) in DIR on the matrix and exit\n"
+           "  --verify-golden FILE  compare the frames of every minute and seconds mode with a golden corpus and exit\n"
+           "  --update-golden FILE  write the golden corpus of the current rendering and exit\n"
+           "  --golden-dump DIR     where --verify-golden writes mismatching frames as PPM (default golden-mismatch)\n"
+           "  --bench NAME          run a micro benchmark and exit (raster, log, mqtt, state, effects, vm, output)\n"
+           "  --assemble IN OUT     assemble the effect IN (see effect_asm.h) into OUT, for uploading, and exit\n"
+           "  --router-seed A,B,..  print the first collision free seed of a CommandRouter for these commands and exit\n",
+           name);
+}
+
+static bool parseOptions(int argc, char** argv, Options* opt)
+{
+    *opt = Options{0, 24 * 3600, 3000, 0, -1, -1, true, false, 1024, false, false, false, false, false, false, false, NULL, NULL, NULL, "golden-mismatch", NULL, NULL, NULL, NULL};
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        unsigned h, m, s;
+
+        if (strcmp(arg, "--start") == 0 && val && sscanf(val, "%u:%u:%u", &h, &m, &s) == 3)
+            opt->start_sec = (h % 24) * 3600 + (m % 60) * 60 + (s % 60), i++;
+        else if (strcmp(arg, "--hours") == 0 && val)
+            opt->duration_sec = atof(val) * 3600, i++;
+        else if (strcmp(arg, "--seconds-mode") == 0 && val)
+            opt->seconds_mode = atoi(val), i++;
+        else if (strcmp(arg, "--splash") == 0 && val)
+            opt->splash = atoi(val), i++;
+        else if (strcmp(arg, "--wifi-ms") == 0 && val)
+            opt->wifi_ms = atoi(val), i++;
+        else if (strcmp(arg, "--task-delay") == 0 && val)
+            opt->task_delay = atoi(val), i++;
+        else if (strcmp(arg, "--no-wire-time") == 0)
+            opt->wire_time = false;
+        else if (strcmp(arg, "--blocking-output") == 0)
+            opt->blocking_output = true;
+        else if (strcmp(arg, "--history") == 0 && val)
+            opt->history = atoi(val), i++;
+        else if (strcmp(arg, "--verbose") == 0)
+            opt->verbose = true;
+        else if (strcmp(arg, "--verify-masks") == 0)
+            opt->verify_masks = true;
+        else if (strcmp(arg, "--verify-mapping") == 0)
+            opt->verify_mapping = true;
+        else if (strcmp(arg, "--verify-time") == 0)
+            opt->verify_time = true;
+        else if (strcmp(arg, "--verify-stream") == 0)
+            opt->verify_stream = true;
+        else if (strcmp(arg, "--verify-mirror") == 0)
+            opt->verify_mirror = true;
+        else if (strcmp(arg, "--verify-output") == 0)
+            opt->verify_output = true;
+        else if (strcmp(arg, "--verify-effects") == 0 && val)
+            opt->verify_effects = val, i++;
+        else if (strcmp(arg, "--verify-golden") == 0 && val)
+            opt->verify_golden = val, i++;
+        else if (strcmp(arg, "--update-golden") == 0 && val)
+            opt->update_golden = val, i++;
+        else if (strcmp(arg, "--golden-dump") == 0 && val)
+            opt->golden_dump = val, i++;
+        else if (strcmp(arg, "--bench") == 0 && val)
+            opt->bench = val, i++;
+        else if (strcmp(arg, "--assemble") == 0 && val && i + 2 < argc)
+            opt->assemble_in = val, opt->assemble_out = argv[i + 2], i += 2;
+        else if (strcmp(arg, "--router-seed") == 0 && val)
+            opt->router_seed = val, i++;
+        else
+            return false;
+    }
+    return true;
+}
+
+// compares the table lookup of WordFrame::fromTime() with the rule based composition for every time of day
+static int verifyMasks()
+{
+    unsigned mismatches = 0;
+    for (uint8_t hour = 0; hour < 12; hour++)
+    {
+        for (uint8_t minute = 0; minute < 60; minute++)
+        {
+            WordFrame table, rules;
+            if (table.fromTime(hour, minute) != rules.fromTimeRules(hour, minute))
+            {
+                printf("mask mismatch at %02u:%02u\n", hour, minute);
+                mismatches++;
+            }
+        }
+    }
+    printf("%u of 720 word masks differ from the rules\n", mismatches);
+    return (mismatches == 0) ? 0 : 1;
+}
+
+// the seed for the CommandRouter of a table (see CommandRouter.h), searched once here instead of at every boot
+static int findRouterSeed(const char* names)
+{
+    std::vector<std::string>            split;
+    std::vector<CommandRouter::Command> commands;
+    for (const char* begin = names; ; )
+    {
+        const char* end = strchr(begin, ',');
+        split.push_back(end ? std::string(begin, end) : std::string(begin));
+        if (end == NULL)
+            break;
+        begin = end + 1;
+    }
+    if (split.size() > CommandRouter::MAX_COMMANDS)
+    {
+        printf("at most %u commands\n", CommandRouter::MAX_COMMANDS);
+        return 1;
+    }
+    for (size_t i = 0; i < split.size(); i++)
+    {
+        if (std::count(split.begin(), split.end(), split[i]) > 1)
+        {
+            printf("command %s twice\n", split[i].c_str());
+            return 1;
+        }
+    }
+    for (const std::string& name : split)
+        commands.push_back(CommandRouter::Command{name.c_str(), "", 0, 0, NULL});
+
+    for (uint32_t seed = 1; seed != 0; seed++)
+    {
+        if (CommandRouter::isPerfect(commands.data(), commands.size(), seed))
+        {
+            printf("%u commands, seed %u\n", (unsigned) commands.size(), seed);
+            return 0;
+        }
+    }
+    printf("no seed\n");
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    Options opt;
+    if (!parseOptions(argc, argv, &opt))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    if (opt.verify_masks)
+    {
+        return verifyMasks();
+    }
+    if (opt.verify_mapping)
+    {
+        bool ok = LedMapping::isPermutation();
+        printf("led mapping (layout %d, rotation %d, %s, %d segment(s)): %s\n", MATRIX_LAYOUT, MATRIX_ROTATION,
+               MATRIX_MIRRORED ? "mirrored" : "not mirrored", MATRIX_SEGMENTS, ok ? "ok" : "NOT a permutation");
+        return ok ? 0 : 1;
+    }
+    if (opt.verify_time)
+    {
+        return verifyTime();
+    }
+    if (opt.verify_stream)
+    {
+        return verifyStream();
+    }
+    if (opt.verify_mirror)
+    {
+        return verifyMirror();
+    }
+    if (opt.verify_output)
+    {
+        return verifyOutput();
+    }
+    if (opt.verify_effects != NULL)
+    {
+        return verifyEffects(opt.verify_effects);
+    }
+    if (opt.verify_golden != NULL)
+    {
+        return verifyGolden(opt.verify_golden, opt.golden_dump);
+    }
+    if (opt.update_golden != NULL)
+    {
+        return updateGolden(opt.update_golden);
+    }
+    if (opt.assemble_in != NULL)
+    {
+        std::vector<uint8_t> bytes;
+        std::string error;
+        if (!assembleEffectFile(opt.assemble_in, &bytes, &error))
+        {
+            printf("%s\n", error.c_str());
+            return 1;
+        }
+        FILE* file = fopen(opt.assemble_out, "wb");
+        bool ok = (file != NULL && fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size());
+        if (file != NULL)
+            ok &= (fclose(file) == 0);
+        printf("%s: %u bytes%s\n", opt.assemble_out, (unsigned) bytes.size(), ok ? "" : ", cannot write");
+        return ok ? 0 : 1;
+    }
+    if (opt.router_seed != NULL)
+    {
+        return findRouterSeed(opt.router_seed);
+    }
+    if (opt.bench != NULL)
+    {
+        if (strcmp(opt.bench, "raster") == 0)
+            return benchRaster();
+        if (strcmp(opt.bench, "log") == 0)
+            return benchLog();
+        if (strcmp(opt.bench, "mqtt") == 0)
+            return benchCommands();
+        if (strcmp(opt.bench, "state") == 0)
+            return benchState();
+        if (strcmp(opt.bench, "effects") == 0)
+            return benchEffects();
+        if (strcmp(opt.bench, "vm") == 0)
+            return benchVm();
+        if (strcmp(opt.bench, "output") == 0)
+            return benchOutput();
+        usage(argv[0]);
+        return 1;
+    }
+
+    EmuLedStrip::setHistoryLimit(opt.history);
+    EmuLedStrip::setWireTimeEmulation(opt.wire_time);
+    EmuLedStrip::setForceBlocking(opt.blocking_output);
+
+    LedMatrix led_matrix;
+    if (opt.seconds_mode >= 0)
+        led_matrix.setSecondsMode(opt.seconds_mode);
+    if (opt.splash >= 0)
+        led_matrix.setSplashScreen(opt.splash);
+    led_matrix.setup();
+    led_matrix.setRenderTask(xTaskGetCurrentTaskHandle());
+
+    const uint64_t end_us    = opt.duration_sec * 1000000ULL;
+    uint32_t previous_time   = UINT32_MAX;
+    uint64_t update_calls    = 0;
+    uint64_t update_cpu_ns   = 0;
+    uint64_t update_cpu_max  = 0;
+    uint32_t task_loop_max   = 0;   // gProcessTimeTaskLoop as seen by the firmware [ms]
+    uint64_t task_loop_sum   = 0;
+    uint32_t hour_shows      = 0;
+    uint64_t task_busy_us    = 0;   // virtual time spent inside update(), i.e. blocked in Show() or delay()
+
+    auto wall_begin = std::chrono::steady_clock::now();
+
+    while (VirtualClock::micros() < end_us)
+    {
+        // --- main loop (setup() blocks in initWiFi() until the network is up) ---
+        if (WiFi.status() != WL_CONNECTED && millis() >= opt.wifi_ms)
+        {
+            WiFi.setStatus(WL_CONNECTED);
+        }
+        if (WiFi.status() == WL_CONNECTED)
+        {
+            uint32_t now = (opt.start_sec + VirtualClock::micros() / 1000000) % (24 * 3600);
+            if (now != previous_time)
+            {
+                previous_time = now;
+                // the second began on the full second of the virtual clock, whenever the loop gets here
+                led_matrix.setTime(now / 3600, (now / 60) % 60, now % 60, VirtualClock::micros() / 1000000 * 1000000);
+
+                if (opt.verbose && now % 3600 == 0)
+                {
+                    printf("%02u:00:00   shows=%-8u looptime(max)=%u ms\n",
+                           now / 3600, EmuLedStrip::showCount() - hour_shows, task_loop_max);
+                    hour_shows = EmuLedStrip::showCount();
+                }
+            }
+        }
+
+        // --- led task ---
+        uint32_t time_begin_loop = millis();
+        uint64_t busy_begin_us   = VirtualClock::micros();
+        auto cpu_begin = std::chrono::steady_clock::now();
+
+        uint32_t wait_ms = led_matrix.update();
+
+        uint64_t cpu_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - cpu_begin).count();
+        update_cpu_ns += cpu_ns;
+        update_cpu_max = (cpu_ns > update_cpu_max) ? cpu_ns : update_cpu_max;
+        update_calls++;
+        task_busy_us += VirtualClock::micros() - busy_begin_us;
+
+        uint32_t task_loop = millis() - time_begin_loop;
+        task_loop_sum += task_loop;
+        task_loop_max = (task_loop > task_loop_max) ? task_loop : task_loop_max;
+
+        if (opt.task_delay > 0)
+        {
+            vTaskDelay(opt.task_delay);
+        }
+        else
+        {
+            // like taskLED(), but the main loop runs in between: it wakes the task at the next second at the latest
+            uint32_t next_second_ms = 1000 - millis() % 1000;
+            uint32_t ticks = (wait_ms < next_second_ms) ? wait_ms : next_second_ms;
+            if (WiFi.status() != WL_CONNECTED && millis() < opt.wifi_ms && opt.wifi_ms - millis() < ticks)
+                ticks = opt.wifi_ms - millis();
+            ulTaskNotifyTake(pdTRUE, (ticks > 0) ? ticks : 1);
+        }
+    }
+
+    double wall_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_begin).count();
+    double sim_sec  = VirtualClock::micros() / 1e6;
+
+    printf("simulated:         %.1f s in %.2f s real time (x%.0f)\n", sim_sec, wall_sec, sim_sec / wall_sec);
+    printf("update() calls:    %llu   avg %.0f ns, max %llu ns host cpu\n",
+           (unsigned long long) update_calls, (double) update_cpu_ns / update_calls,
+           (unsigned long long) update_cpu_max);
+    printf("Show() calls:      %u   (%.1f per second)\n", EmuLedStrip::showCount(),
+           EmuLedStrip::showCount() / sim_sec);
+    printf("frames:            %u pushed, %u skipped as unchanged\n",
+           led_matrix.getFramesPushed(), led_matrix.getFramesSkipped());
+    if (opt.wire_time)
+    {
+        uint64_t wire_us    = EmuLedStrip::wireTimeTotalUs();
+        uint64_t blocked_us = EmuLedStrip::blockedTimeTotalUs();
+        printf("wire time:         %.1f s   (%.1f %% of the time), Show() blocked %.1f s: %.1f %% overlapped\n",
+               wire_us / 1e6, 100.0 * wire_us / VirtualClock::micros(), blocked_us / 1e6,
+               (wire_us > 0) ? 100.0 * (wire_us - (double) blocked_us) / wire_us : 0.0);
+    }
+    printf("task loop time:    avg %.2f ms, max %u ms\n", (double) task_loop_sum / update_calls, task_loop_max);
+    printf("led task:          %.1f wakeups per second, busy %.2f %% of the time\n",
+           update_calls / sim_sec, 100.0 * task_busy_us / VirtualClock::micros());
+#if PROFILING_ENABLED
+    printf("render path:       [us] host cpu, tick_to_frame in virtual time; %u frame deadline(s) missed\n",
+           Profiler::getMissedDeadlines());
+    for (uint8_t stage = 0; stage < Profiler::STAGE_COUNT; stage++)
+    {
+        Profiler::Histogram h;
+        Profiler::snapshot(stage, &h);
+        if (h.count == 0)
+            continue;
+        printf("  %-16s %8u x   avg %8.1f   p50 %6u   p90 %6u   p99 %6u   max %6u\n",
+               Profiler::stageName(stage), h.count, Profiler::averageNs(h) / 1000.0, Profiler::percentile(h, 50),
+               Profiler::percentile(h, 90), Profiler::percentile(h, 99), h.max_us);
+    }
+#endif
+    return 0;
+}
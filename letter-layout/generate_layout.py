@@ -0,0 +1,345 @@
+#!/usr/bin/env python3
+"""Compiles a letter layout description into the C++ header the firmware uses (see WordFrame.cpp).
+
+    generate_layout.py LAYOUT.txt HEADER.h      generate the header (after verifying every frame)
+    generate_layout.py --check LAYOUT.txt HEADER.h  fail if the header is not up to date
+    generate_layout.py --verify LAYOUT.txt HEADER.h check every time mask in the header against the grid
+
+Layout description (UTF-8, '#' starts a comment):
+
+    [grid]      the letters, one line per row, all of the same length (at most 32)
+
+    [hours]     per hour 0..11: its word, optionally followed by a second form for full hours
+                (German "EINS" -> "EIN UHR")
+
+    [minutes]   per minute 0..59: the sentence shown, with the placeholders {H} (the hour), {H+1} (the next
+                hour) and {H.full} (the hour in its full hour form)
+
+A word of a sentence is lit at its first occurrence in reading order behind the previous word. WORD@ROW
+pins it to its first occurrence in the given row instead, which is needed where reading order is ambiguous
+(usually for the hours). Every frame is verified: the lit letters, read row by row, must spell exactly the
+words of the sentence, each separated from the others, so that the generated tables cannot contain a mask
+that does not read as intended.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+
+class LayoutError(Exception):
+    pass
+
+
+class Word:
+    def __init__(self, text, x, y):
+        self.text = text
+        self.x = x
+        self.y = y
+
+    @property
+    def name(self):
+        ascii_text = (self.text.replace('Ä', 'AE').replace('Ö', 'OE').replace('Ü', 'UE').replace('ß', 'SS'))
+        return 'W%d_%s' % (self.y, ascii_text)
+
+    def cells(self):
+        return [(self.x + i, self.y) for i in range(len(self.text))]
+
+    def key(self):
+        return (self.y, self.x, self.text)
+
+
+class Layout:
+    def __init__(self, path):
+        self.path = path
+        self.grid = []
+        self.hours = {}    # hour -> (word spec, full hour word spec)
+        self.minutes = {}  # minute -> [token]
+        self._parse()
+        self.width = len(self.grid[0])
+        self.height = len(self.grid)
+
+    def _parse(self):
+        section = None
+        with open(self.path, encoding='utf-8') as f:
+            for number, line in enumerate(f, 1):
+                line = line.split('#', 1)[0].strip()
+                if not line:
+                    continue
+                where = '%s:%d' % (self.path, number)
+                match = re.fullmatch(r'\[(\w+)\]', line)
+                if match:
+                    section = match.group(1)
+                    if section not in ('grid', 'hours', 'minutes'):
+                        raise LayoutError('%s: unknown section [%s]' % (where, section))
+                elif section == 'grid':
+                    self.grid.append(line)
+                elif section == 'hours':
+                    fields = line.split()
+                    if len(fields) not in (2, 3):
+                        raise LayoutError('%s: expected "hour word [full hour word]"' % where)
+                    self.hours[int(fields[0])] = (fields[1], fields[-1])
+                elif section == 'minutes':
+                    fields = line.split()
+                    self.minutes[int(fields[0])] = fields[1:]
+                else:
+                    raise LayoutError('%s: text outside of a section' % where)
+
+        if not self.grid or any(len(row) != len(self.grid[0]) for row in self.grid):
+            raise LayoutError('%s: the grid rows must all have the same length' % self.path)
+        if len(self.grid[0]) > 32:
+            raise LayoutError('%s: at most 32 columns are supported (rows are stored as uint32_t)' % self.path)
+        if sorted(self.hours) != list(range(12)):
+            raise LayoutError('%s: [hours] must define the hours 0..11' % self.path)
+        if sorted(self.minutes) != list(range(60)):
+            raise LayoutError('%s: [minutes] must define the minutes 0..59' % self.path)
+
+    def find(self, spec, after):
+        """places 'WORD' behind position 'after' (y, x), or 'WORD@ROW' in that row"""
+        text, _, row = spec.partition('@')
+        if row:
+            y = int(row)
+            x = self.grid[y].find(text) if 0 <= y < self.height else -1
+            if x < 0:
+                raise LayoutError('"%s" is not in row %d' % (text, y))
+            return Word(text, x, y)
+        y, x = after
+        while y < self.height:
+            x = self.grid[y].find(text, x)
+            if x >= 0:
+                return Word(text, x, y)
+            y, x = y + 1, 0
+        raise LayoutError('no "%s" behind row %d, column %d' % (text, after[0], after[1]))
+
+    def place(self, tokens, hour_specs):
+        """the words of a sentence, with the hour placeholders resolved by 'hour_specs'"""
+        words = []
+        after = (0, 0)
+        for token in tokens:
+            spec = hour_specs.get(token, token)
+            if spec.startswith('{'):
+                raise LayoutError('unknown placeholder %s' % token)
+            word = self.find(spec, after)
+            words.append(word)
+            after = (word.y, word.x + len(word.text) + 1)
+        return words
+
+    def compile(self):
+        """returns the minute rules, hour words and the words of every time"""
+        rules = []       # per minute: (minute words, hour offset, full hour form)
+        hour_words = []  # per hour: (word, full hour word)
+        for hour in range(12):
+            hour_words.append(tuple(self.find(spec, (0, 0)) for spec in self.hours[hour]))
+
+        times = []  # index hour * 60 + minute: (sentence, words)
+        for minute in range(60):
+            tokens = self.minutes[minute]
+            hour_tokens = [t for t in tokens if t in ('{H}', '{H+1}', '{H.full}')]
+            if len(hour_tokens) != 1:
+                raise LayoutError('minute %d: the sentence needs exactly one hour placeholder' % minute)
+            offset = 1 if hour_tokens[0] == '{H+1}' else 0
+            full = 1 if hour_tokens[0] == '{H.full}' else 0
+            try:
+                words = self.place(tokens, {hour_tokens[0]: self.hours[0][0]})
+            except LayoutError as e:
+                raise LayoutError('minute %d: %s' % (minute, e))
+            rules.append(([w for t, w in zip(tokens, words) if t != hour_tokens[0]], offset, full))
+
+        for hour in range(12):
+            for minute in range(60):
+                tokens = self.minutes[minute]
+                spoken = (hour + rules[minute][1]) % 12
+                specs = {'{H}': self.hours[spoken][0], '{H+1}': self.hours[spoken][0],
+                         '{H.full}': self.hours[spoken][1]}
+                try:
+                    words = self.place(tokens, specs)
+                except LayoutError as e:
+                    raise LayoutError('%02d:%02d: %s' % (hour, minute, e))
+                sentence = ' '.join(specs.get(t, t).partition('@')[0] for t in tokens)
+                times.append((sentence, words))
+        return rules, hour_words, times
+
+    def mask(self, words):
+        rows = [0] * self.height
+        for word in words:
+            for x, y in word.cells():
+                rows[y] |= 1 << x
+        return rows
+
+    def verify(self, sentence, rows):
+        """checks that the lit letters of the mask read as the sentence, returns an error or None"""
+        runs = []
+        for y in range(self.height):
+            x = 0
+            while x < self.width:
+                if rows[y] >> x & 1:
+                    start = x
+                    while x < self.width and rows[y] >> x & 1:
+                        x += 1
+                    runs.append(self.grid[y][start:x])
+                x += 1
+        expected = [t.partition('@')[0] for t in sentence.split()]
+        if runs != expected:
+            return 'reads "%s" instead of "%s"' % (' '.join(runs), ' '.join(expected))
+        return None
+
+
+def unique_words(rules, hour_words, times):
+    words = {}
+    for minute_words, _, _ in rules:
+        for word in minute_words:
+            words[word.key()] = word
+    for forms in hour_words:
+        for word in forms:
+            words[word.key()] = word
+    for _, time_words in times:
+        for word in time_words:
+            if word.key() not in words:
+                raise LayoutError('word %s is neither a minute nor an hour word' % word.name)
+    return [words[key] for key in sorted(words)]
+
+
+def generate(layout, header_path):
+    rules, hour_words, times = layout.compile()
+
+    errors = []
+    for index, (sentence, words) in enumerate(times):
+        error = layout.verify(sentence, layout.mask(words))
+        minute_words, offset, full = rules[index % 60]
+        hour_word = hour_words[(index // 60 + offset) % 12][full]
+        if not error and layout.mask(minute_words + [hour_word]) != layout.mask(words):
+            error = 'the words behind the hour depend on the hour, pin them with @ROW'
+        if error:
+            errors.append('%02d:%02d %s' % (index // 60, index % 60, error))
+    if errors:
+        raise LayoutError('\n'.join(errors))
+
+    words = unique_words(rules, hour_words, times)
+    ids = {word.key(): i for i, word in enumerate(words)}
+    max_minute_words = max(len(minute_words) for minute_words, _, _ in rules)
+
+    guard = '__' + re.sub(r'\W', '_', os.path.basename(header_path)).upper()
+    repository = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    source = os.path.relpath(os.path.abspath(layout.path), repository)
+    out = []
+    out.append('// Generated by letter-layout/generate_layout.py from %s -- do not edit.' % source.replace(os.sep, '/'))
+    out.append('// Included by WordFrame.cpp only.')
+    out.append('')
+    out.append('#ifndef %s' % guard)
+    out.append('#define %s' % guard)
+    out.append('')
+    out.append('namespace LetterLayout {')
+    out.append('')
+    out.append('const uint8_t WIDTH            = %d;' % layout.width)
+    out.append('const uint8_t HEIGHT           = %d;' % layout.height)
+    out.append('const uint8_t MAX_MINUTE_WORDS = %d;' % max_minute_words)
+    out.append('')
+    out.append('typedef %s Row;  // bit x = column x' % ('uint16_t' if layout.width <= 16 else 'uint32_t'))
+    out.append('')
+    out.append('// letters, row by row:')
+    for row in layout.grid:
+        out.append('//     %s' % ' '.join(row))
+    out.append('')
+    out.append('enum WordId')
+    out.append('{')
+    name_width = max(len(word.name) for word in words)
+    for i, word in enumerate(words):
+        out.append('    %-*s = %2d,' % (name_width, word.name, i))
+    out.append('    WORD_COUNT')
+    out.append('};')
+    out.append('')
+    out.append('constexpr WordFrame::Word WORDS[WORD_COUNT] PROGMEM =')
+    out.append('{')
+    for word in words:
+        out.append('    { %2d, %2d, %2d },  // %s' % (word.x, word.y, len(word.text), word.name))
+    out.append('};')
+    out.append('')
+    out.append('typedef struct')
+    out.append('{')
+    out.append('    uint8_t hour_offset;               // 0: the current hour, 1: the next one')
+    out.append('    uint8_t hour_form;                 // index into HOUR_WORDS[hour]')
+    out.append('    uint8_t word_count;')
+    out.append('    uint8_t words[MAX_MINUTE_WORDS];   // WordId')
+    out.append('} MinuteRule;')
+    out.append('')
+    out.append('constexpr MinuteRule MINUTE_RULES[60] PROGMEM =')
+    out.append('{')
+    for minute, (minute_words, offset, full) in enumerate(rules):
+        word_list = ', '.join(word.name for word in minute_words)
+        out.append('    { %d, %d, %d, { %s } },  // %2d: %s' % (offset, full, len(minute_words), word_list, minute,
+                                                          ' '.join(layout.minutes[minute])))
+    out.append('};')
+    out.append('')
+    out.append('// per hour: the word, the word at the full hour')
+    out.append('constexpr uint8_t HOUR_WORDS[12][2] PROGMEM =')
+    out.append('{')
+    for hour, (normal, full) in enumerate(hour_words):
+        out.append('    { %s, %s },  // %2d' % (normal.name, full.name, hour))
+    out.append('};')
+    out.append('')
+    out.append('// the rows of the mask of every time of day, index: hour * 60 + minute')
+    out.append('constexpr Row TIME_MASKS[12 * 60][HEIGHT] PROGMEM =')
+    out.append('{')
+    for index, (sentence, time_words) in enumerate(times):
+        digits = 4 if layout.width <= 16 else 8
+        rows = ', '.join('0x%0*x' % (digits, row) for row in layout.mask(time_words))
+        out.append('    { %s },  // %02d:%02d %s' % (rows, index // 60, index % 60, sentence))
+    out.append('};')
+    out.append('')
+    out.append('}  // namespace LetterLayout')
+    out.append('')
+    out.append('#endif  // %s' % guard)
+    return '\n'.join(out) + '\n'
+
+
+def verify_header(layout, header_path):
+    """re-reads the time masks of a generated header and checks them against the grid"""
+    with open(header_path, encoding='utf-8') as f:
+        text = f.read()
+    block = text.split('TIME_MASKS', 1)[-1]
+    entries = re.findall(r'\{ ([0-9a-fx, ]+) \},\s*// (\d\d):(\d\d) ([^\n]*)', block)
+    if len(entries) != 12 * 60:
+        raise LayoutError('%s: found %d time masks instead of 720' % (header_path, len(entries)))
+    times = layout.compile()[2]
+    errors = []
+    for rows_text, hour, minute, _ in entries:
+        rows = [int(value, 16) for value in rows_text.split(', ')]
+        error = layout.verify(times[int(hour) * 60 + int(minute)][0], rows)
+        if error:
+            errors.append('%s:%s %s' % (hour, minute, error))
+    if errors:
+        raise LayoutError('\n'.join(errors))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    mode = parser.add_mutually_exclusive_group()
+    mode.add_argument('--check', action='store_true', help='fail if the header is not up to date')
+    mode.add_argument('--verify', action='store_true', help='check the masks in the header against the grid')
+    parser.add_argument('layout')
+    parser.add_argument('header')
+    args = parser.parse_args()
+
+    try:
+        layout = Layout(args.layout)
+        if args.verify:
+            verify_header(layout, args.header)
+            print('%s: all 720 frames read as intended' % args.header)
+            return 0
+        content = generate(layout, args.header)
+        if args.check:
+            with open(args.header, encoding='utf-8') as f:
+                if f.read() != content:
+                    raise LayoutError('%s is not up to date with %s' % (args.header, args.layout))
+            return 0
+        with open(args.header, 'w', encoding='utf-8') as f:
+            f.write(content)
+        return 0
+    except (LayoutError, OSError, ValueError) as e:
+        print('error: %s' % e, file=sys.stderr)
+        return 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())